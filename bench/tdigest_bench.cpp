@@ -0,0 +1,129 @@
+/*
+ * File:   tdigest_bench.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 23, 2026, 11:40 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+/*
+ * Compares the percentiles of TDigest with the exact percentiles of Statistic
+ * on generated durations and measures the cost of TDigest::add(). The values
+ * are spread over several digests, which are serialized, deserialized and
+ * merged like the digests of different processes.
+ *
+ * Usage: tdigest_bench [values] [digests]
+ *
+ * Build with -DCMAKE_BUILD_TYPE=Release for meaningful timings.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <random>
+#include <vector>
+#include "Timer.h"
+#include "Statistic.h"
+#include "TDigest.h"
+
+int main(int argc, char** argv) {
+    std::size_t valueCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10)
+                                      : 1000000;
+    std::size_t digestCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10)
+                                       : 8;
+    if (valueCount == 0 or digestCount == 0) {
+        std::fprintf(stderr, "usage: %s [values] [digests]\n", argv[0]);
+        return 1;
+    }
+
+    // durations in nanoseconds, median 50 us with a long tail
+    std::mt19937_64 generator(42);
+    std::lognormal_distribution<double> distribution(std::log(50000.0), 1.0);
+    std::vector<double> values(valueCount);
+    for (double& value : values)
+        value = distribution(generator);
+
+    std::vector<TDigest> digests(digestCount);
+    Timer addTimer;
+    addTimer.start();
+    for (std::size_t i = 0; i < valueCount; ++i)
+        digests[i % digestCount].add(values[i]);
+    addTimer.stop();
+
+    TDigest merged;
+    std::size_t blobSize = 0;
+    Timer mergeTimer;
+    mergeTimer.start();
+    for (const TDigest& digest : digests) {
+        std::vector<std::uint8_t> blob = digest.serialize();
+        blobSize += blob.size();
+        merged.merge(TDigest::deserialize(blob));
+    }
+    mergeTimer.stop();
+
+    Timer statisticTimer;
+    statisticTimer.start();
+    Statistic exact(std::list<double>(values.begin(), values.end()));
+    statisticTimer.stop();
+
+    std::printf("values:     %zu in %zu digests\n", valueCount, digestCount);
+    std::printf("add:        %.1f ns per value\n",
+        addTimer.getTimeInNanoSeconds() / valueCount);
+    std::printf("merge:      %.1f us for all digests\n",
+        mergeTimer.getTimeInMicroSeconds());
+    std::printf("blob:       %.0f bytes per digest\n",
+        static_cast<double>(blobSize) / digestCount);
+    std::printf("centroids:  %zu after merging\n", merged.getCentroidCount());
+    std::printf("Statistic:  %.1f ns per value to sort\n\n",
+        statisticTimer.getTimeInNanoSeconds() / valueCount);
+
+    const double percentiles[] = {1, 10, 25, 50, 75, 90, 99, 99.9, 99.99};
+    double maxError = 0;
+    std::printf("%10s %16s %16s %10s\n",
+        "percentile", "Statistic", "TDigest", "error");
+    for (double percentile : percentiles) {
+        double expected = exact.getPercentile(percentile);
+        double estimated = merged.getPercentile(percentile);
+        double error = (estimated - expected) / expected;
+        maxError = std::max(maxError, std::abs(error));
+        std::printf("%10g %16.1f %16.1f %+9.3f%%\n",
+            percentile, expected, estimated, 100 * error);
+    }
+    std::printf("\nmaximum relative error: %.3f%%\n", 100 * maxError);
+
+    return 0;
+}
@@ -0,0 +1,169 @@
+/*
+ * File:   Calibration.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 16, 2026, 3:30 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Calibration.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/*
+ * Reads the clock twice in a row for every sample and stores the differences.
+ * The median is robust against samples disturbed by interrupts or preemption,
+ * which is why it is used as the overhead instead of the mean.
+ */
+template<class Clock>
+void Calibration<Clock>::calibrate(const int samples) {
+    if(samples <= 0) {  // nothing to measure
+        return;
+    }
+
+    std::vector<std::int64_t> differences(samples);
+
+    // warm up the caches and the code reading the clock
+    for(int i = 0; i < samples / 10 + 1; ++i) {
+        Clock::read();
+    }
+
+    for(int i = 0; i < samples; ++i) {
+        std::int64_t first = Clock::read();
+        std::int64_t second = Clock::read();
+
+        differences[i] = second - first;
+    }
+
+    /*calculate mean and standard deviation of the differences*/
+    double mean = 0.0;
+    for(std::int64_t difference: differences) {
+        mean += difference;
+    }
+    mean /= samples;
+
+    double variance = 0.0;
+    for(std::int64_t difference: differences) {
+        variance += (difference - mean) * (difference - mean);
+    }
+    variance /= samples;
+
+    /*find the median and the minimum*/
+    std::nth_element(differences.begin(),
+        differences.begin() + samples / 2, differences.end());
+    std::int64_t median = differences[samples / 2];
+    std::int64_t minimum =
+        *std::min_element(differences.begin(), differences.end());
+
+    State& state = getState();
+
+    state.mOverhead.store(median);
+    state.mMinimumOverhead.store(minimum);
+    state.mJitter.store(llround(sqrt(variance)));
+    state.mIsCalibrated.store(true);
+}
+
+/*
+ * Returns whether there are measured values.
+ */
+template<class Clock>
+bool Calibration<Clock>::isCalibrated() {
+    return getState().mIsCalibrated.load();
+}
+
+/*
+ * Converts the median overhead to a Timestamp.
+ */
+template<class Clock>
+Timestamp Calibration<Clock>::getOverhead() {
+    return Clock::toTimestamp(getState().mOverhead.load());
+}
+
+/*
+ * Returns the median overhead as measured.
+ */
+template<class Clock>
+std::int64_t Calibration<Clock>::getOverheadTicks() {
+    return getState().mOverhead.load();
+}
+
+/*
+ * Converts the minimal overhead to a Timestamp.
+ */
+template<class Clock>
+Timestamp Calibration<Clock>::getMinimumOverhead() {
+    return Clock::toTimestamp(getState().mMinimumOverhead.load());
+}
+
+/*
+ * Converts the standard deviation to a Timestamp.
+ */
+template<class Clock>
+Timestamp Calibration<Clock>::getJitter() {
+    return Clock::toTimestamp(getState().mJitter.load());
+}
+
+/*
+ * The resolution is the one reported by the clock.
+ */
+template<class Clock>
+Timestamp Calibration<Clock>::getResolution() {
+    return Clock::getResolution();
+}
+
+/*
+ * Calibrates the clock if necessary, before the subtraction is enabled.
+ */
+template<class Clock>
+void Calibration<Clock>::setBiasSubtraction(const bool enabled) {
+    if(enabled and !isCalibrated()) {
+        calibrate();
+    }
+
+    getState().mSubtractBias.store(enabled);
+}
+
+/*
+ * Returns whether the subtraction is enabled.
+ */
+template<class Clock>
+bool Calibration<Clock>::isBiasSubtractionEnabled() {
+    return getState().mSubtractBias.load();
+}
+
+template class Calibration<RealtimeClock>;
+template class Calibration<MonotonicClock>;
+template class Calibration<MonotonicRawClock>;
+template class Calibration<BoottimeClock>;
+template class Calibration<ProcessCpuClock>;
+template class Calibration<ThreadCpuClock>;
+template class Calibration<TscClock>;
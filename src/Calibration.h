@@ -0,0 +1,165 @@
+/*
+ * File:   Calibration.h
+ * Author: Nils Döring
+ *
+ * Created on October 16, 2026, 3:30 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CALIBRATION_H
+#define	CALIBRATION_H
+
+#include <atomic>
+#include <cstdint>
+#include "Timestamp.h"
+#include "Clock.h"
+
+/**
+ * \brief This class measures the cost of reading a clock.
+ *
+ * Every measurement includes the time needed to read the clock at its start and
+ * at its stop. For very short regions this overhead can dominate the result.
+ * calibrate() reads the clock many times back to back and stores the median
+ * and the standard deviation of the differences as overhead and jitter.
+ *
+ * If the bias subtraction is enabled, Timer and FastTimer subtract the
+ * overhead from every duration they return, but never return a negative
+ * duration. Timerseries uses the durations of its Timer and is corrected as
+ * well. The subtraction is disabled by default.
+ *
+ * There is one calibration per clock. All methods are static.
+ *
+ * \attention Reading the results is thread-safe, but calibrate() must not be
+ * called concurrently for the same clock.
+ * \tparam Clock One of the clock policies defined in Clock.h.
+ */
+template<class Clock>
+class Calibration {
+public:
+    /**
+     * \brief Measures the overhead and jitter of reading the clock.
+     *
+     * The clock is read 2 * samples times. This takes less than a millisecond
+     * for the default number of samples and the usual clocks.
+     * @param samples
+     */
+    static void calibrate(const int samples = 10000);
+
+    /**
+     * \brief Returns whether calibrate() has been called.
+     */
+    static bool isCalibrated();
+
+    /**
+     * \brief Returns the median cost of reading the clock.
+     */
+    static Timestamp getOverhead();
+
+    /**
+     * \brief Returns the median cost of reading the clock in the raw unit of
+     * the clock.
+     */
+    static std::int64_t getOverheadTicks();
+
+    /**
+     * \brief Returns the minimal cost of reading the clock.
+     */
+    static Timestamp getMinimumOverhead();
+
+    /**
+     * \brief Returns the standard deviation of the cost of reading the clock.
+     */
+    static Timestamp getJitter();
+
+    /**
+     * \brief Returns the resolution of the clock.
+     *
+     * This is the value reported by clock_getres() for the POSIX clocks.
+     */
+    static Timestamp getResolution();
+
+    /**
+     * \brief Enables or disables the subtraction of the overhead.
+     *
+     * If the clock has not been calibrated yet, this calibrates it.
+     * @param enabled
+     */
+    static void setBiasSubtraction(const bool enabled);
+
+    /**
+     * \brief Returns whether the overhead is subtracted from durations.
+     */
+    static bool isBiasSubtractionEnabled();
+
+    /**
+     * \brief Subtracts the overhead from a duration given in the raw unit of
+     * the clock, if the bias subtraction is enabled.
+     *
+     * The result is never negative.
+     * @param ticks
+     */
+    static std::int64_t correct(const std::int64_t ticks) {
+        const State& state = getState();
+
+        if(!state.mSubtractBias.load(std::memory_order_relaxed)) {
+            return ticks;
+        }
+
+        std::int64_t corrected =
+            ticks - state.mOverhead.load(std::memory_order_relaxed);
+
+        return corrected > 0 ? corrected : 0;
+    }
+
+private:
+    /**
+     * \brief The results of the calibration of one clock.
+     */
+    struct State {
+        std::atomic<bool> mIsCalibrated;
+        std::atomic<bool> mSubtractBias;
+        std::atomic<std::int64_t> mOverhead;
+        std::atomic<std::int64_t> mMinimumOverhead;
+        std::atomic<std::int64_t> mJitter;
+    };
+
+    /*
+     * The state is a local static of an inline method, so correct() and thus
+     * FastTimer work without the library. It is zero-initialized before any
+     * code runs.
+     */
+    static State& getState() {
+        static State state;
+
+        return state;
+    }
+};
+
+#endif	/* CALIBRATION_H */
@@ -0,0 +1,372 @@
+/*
+ * File:   Clock.h
+ * Author: Nils Döring
+ *
+ * Created on October 16, 2026, 9:10 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CLOCK_H
+#define	CLOCK_H
+
+#include <time.h>
+#include <cmath>
+#include <cstdint>
+#include "Timestamp.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define HRTPP_HAS_TSC
+#endif /*__x86_64__ || __i386__*/
+
+/**
+ * \brief This class is a clock policy for the clocks provided by
+ * clock_gettime().
+ *
+ * The clock is chosen with the template parameter. Timer and Timerseries are
+ * instantiated on such a policy, so the clock to read is known at compile time
+ * and starting or stopping a Timer does not have to decide which clock to use.
+ * See man 3 clock_gettime for a description of the clocks.
+ *
+ * A clock policy provides read(), returning a raw reading in the unit of the
+ * clock, and toTimestamp(), converting the difference of two readings. For
+ * these clocks a reading is the time in nanoseconds.
+ *
+ * \attention Use the typedefs below instead of instantiating this class with
+ * arbitrary clock ids. Only those are compiled into the library.
+ */
+template<clockid_t ClockId>
+class PosixClock {
+public:
+    /**
+     * \brief The id of the clock as used by clock_gettime().
+     */
+    static const clockid_t id = ClockId;
+
+    /**
+     * \brief Returns the current reading of this clock in nanoseconds.
+     */
+    static std::int64_t read() {
+        struct timespec time;
+
+        clock_gettime(ClockId, &time);
+
+        return time.tv_sec * static_cast<std::int64_t>(1000000000)
+            + time.tv_nsec;
+    }
+
+    /**
+     * \brief Converts a number of nanoseconds to a Timestamp.
+     * @param ticks
+     */
+    static constexpr Timestamp toTimestamp(const std::int64_t ticks) {
+        return Timestamp::fromNanoSeconds(ticks);
+    }
+
+    /**
+     * \brief Returns the current time of this clock.
+     */
+    static Timestamp now() {
+        struct timespec time;
+
+        clock_gettime(ClockId, &time);
+
+        return Timestamp(time);
+    }
+
+    /**
+     * \brief Returns the resolution of this clock.
+     *
+     * This is the value reported by clock_getres(). See man 3 clock_getres.
+     */
+    static Timestamp getResolution() {
+        struct timespec resolution;
+
+        clock_getres(ClockId, &resolution);
+
+        return Timestamp(resolution);
+    }
+};
+
+template<clockid_t ClockId>
+const clockid_t PosixClock<ClockId>::id;
+
+/**
+ * \brief The system-wide wall clock. It is affected by NTP adjustments and by
+ * setting the system time.
+ */
+typedef PosixClock<CLOCK_REALTIME> RealtimeClock;
+
+/**
+ * \brief A clock that cannot be set. It is slewed by NTP, but never jumps.
+ */
+typedef PosixClock<CLOCK_MONOTONIC> MonotonicClock;
+
+/**
+ * \brief A monotonic clock based on the raw hardware time. It is not subject
+ * to NTP adjustments.
+ */
+typedef PosixClock<CLOCK_MONOTONIC_RAW> MonotonicRawClock;
+
+/**
+ * \brief Like the monotonic clock, but it also counts the time the system was
+ * suspended.
+ */
+typedef PosixClock<CLOCK_BOOTTIME> BoottimeClock;
+
+/**
+ * \brief The CPU time consumed by all threads of the calling process.
+ */
+typedef PosixClock<CLOCK_PROCESS_CPUTIME_ID> ProcessCpuClock;
+
+/**
+ * \brief The CPU time consumed by the calling thread.
+ */
+typedef PosixClock<CLOCK_THREAD_CPUTIME_ID> ThreadCpuClock;
+
+/**
+ * \brief This class is a clock policy reading the time stamp counter of the
+ * processor.
+ *
+ * Reading the counter takes only a few nanoseconds, while clock_gettime() takes
+ * some tens of nanoseconds even through the vDSO. The readings are counted in
+ * cycles of the counter and are converted to nanoseconds only by
+ * toTimestamp(). The conversion factor is calibrated against MonotonicClock the
+ * first time it is needed. Call getNanoSecondsPerTick() at startup to avoid
+ * this delay later on.
+ *
+ * The counter is only used, if the processor reports an invariant time stamp
+ * counter, i.e. one that runs at a constant rate in all power states, and
+ * supports rdtscp. Otherwise this clock falls back to MonotonicClock and a
+ * reading is the time in nanoseconds.
+ *
+ * \attention The readings of the counter are only comparable between
+ * processors if the kernel considers the counter as synchronized. Check for
+ * "tsc" in /sys/devices/system/clocksource/clocksource0/current_clocksource.
+ */
+class TscClock {
+public:
+    /**
+     * \brief Returns the current reading of the time stamp counter.
+     *
+     * The counter is read with rdtscp, which waits until all previous
+     * instructions have been executed. The following lfence keeps subsequent
+     * instructions from being executed before the counter has been read.
+     */
+    static std::int64_t read() {
+        if(getCounter().mIsInvariant) {
+            return readCounter();
+        }
+
+        return MonotonicClock::read();
+    }
+
+    /**
+     * \brief Returns the current time of this clock.
+     *
+     * This is the time since the counter has been reset, usually at boot.
+     */
+    static Timestamp now() {
+        return toTimestamp(read());
+    }
+
+    /**
+     * \brief Converts a number of ticks of the counter to a Timestamp.
+     * @param ticks
+     */
+    static Timestamp toTimestamp(const std::int64_t ticks) {
+        return Timestamp::fromNanoSeconds(
+            std::llround(ticks * getNanoSecondsPerTick()));
+    }
+
+    /**
+     * \brief Returns the resolution of this clock.
+     *
+     * This is the duration of one tick, but at least one nanosecond.
+     */
+    static Timestamp getResolution() {
+        if(!isInvariant()) {
+            return MonotonicClock::getResolution();
+        }
+
+        // a Timestamp cannot hold less than one nanosecond
+        return Timestamp::fromNanoSeconds(
+            std::llround(std::ceil(getNanoSecondsPerTick())));
+    }
+
+    /**
+     * \brief Returns whether the invariant time stamp counter is used.
+     *
+     * If this is false, the clock falls back to MonotonicClock.
+     */
+    static bool isInvariant() {
+        return getCounter().mIsInvariant;
+    }
+
+    /**
+     * \brief Returns the duration of one tick in nanoseconds.
+     *
+     * The value is calibrated once, the first time it is needed.
+     */
+    static double getNanoSecondsPerTick() {
+        static const double nanoSecondsPerTick = calibrate();
+
+        return nanoSecondsPerTick;
+    }
+
+    /**
+     * \brief Measures the duration of one tick in nanoseconds.
+     *
+     * The counter is compared to MonotonicClock over an interval of at least
+     * ten milliseconds since this clock has been used first. Therefore this
+     * returns immediately, unless it is called right after the first use.
+     */
+    static double calibrate() {
+        const Counter& first = getCounter();
+
+        if(!first.mIsInvariant) {
+            return 1.0;
+        }
+
+        Counter reference;
+
+        do {
+            takeReference(reference);
+        } while(reference.mReferenceNanoSeconds - first.mReferenceNanoSeconds
+                < CALIBRATION_INTERVAL);
+
+        return static_cast<double>(reference.mReferenceNanoSeconds -
+                first.mReferenceNanoSeconds) /
+            static_cast<double>(reference.mReferenceTicks -
+                first.mReferenceTicks);
+    }
+
+private:
+    /*
+     * The minimum interval in nanoseconds to calibrate the counter.
+     */
+    static constexpr std::int64_t CALIBRATION_INTERVAL = 10000000;
+
+    /**
+     * \brief The state of the counter, determined when the clock is used
+     * first, together with a reading of the counter and MonotonicClock at the
+     * same moment.
+     */
+    struct Counter {
+        bool mIsInvariant;
+        std::int64_t mReferenceTicks;
+        std::int64_t mReferenceNanoSeconds;
+    };
+
+    /*
+     * The state is a local static, so it is initialized on first use, even
+     * by a read() during the static initialization of another translation
+     * unit, and is shared by all of them.
+     */
+    static const Counter& getCounter() {
+        static const Counter counter = detectCounter();
+
+        return counter;
+    }
+
+    /*
+     * Checks with cpuid whether the processor supports rdtscp and has an
+     * invariant time stamp counter. Both are reported in the extended function
+     * leaves.
+     */
+    static bool hasInvariantTsc() {
+#ifdef HRTPP_HAS_TSC
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+        if(__get_cpuid_max(0x80000000, nullptr) < 0x80000007) {
+            return false;
+        }
+
+        // bit 27 of edx in leaf 0x80000001 signals rdtscp
+        if(!__get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx)
+                or !(edx & (1 << 27))) {
+            return false;
+        }
+
+        // bit 8 of edx in leaf 0x80000007 signals the invariant counter
+        if(!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+            return false;
+        }
+
+        return edx & (1 << 8);
+#else
+        return false;
+#endif /*HRTPP_HAS_TSC*/
+    }
+
+    /*
+     * Checks the counter and takes the first reference if it is used.
+     */
+    static Counter detectCounter() {
+        Counter counter = {hasInvariantTsc(), 0, 0};
+
+        if(counter.mIsInvariant) {
+            takeReference(counter);
+        }
+
+        return counter;
+    }
+
+    /*
+     * Reads the counter between two readings of MonotonicClock and uses the
+     * mean of both as the time of the counter reading.
+     */
+    static void takeReference(Counter& counter) {
+        std::int64_t before = MonotonicClock::read();
+        counter.mReferenceTicks = readCounter();
+        std::int64_t after = MonotonicClock::read();
+
+        counter.mReferenceNanoSeconds = before + (after - before) / 2;
+    }
+
+    /*
+     * Reads the counter like read(), without checking whether it is used.
+     */
+    static std::int64_t readCounter() {
+#ifdef HRTPP_HAS_TSC
+        unsigned int processor;
+        std::int64_t ticks = __rdtscp(&processor);
+
+        _mm_lfence();
+
+        return ticks;
+#else
+        return MonotonicClock::read();
+#endif /*HRTPP_HAS_TSC*/
+    }
+};
+
+#endif	/* CLOCK_H */
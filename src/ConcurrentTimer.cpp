@@ -0,0 +1,375 @@
+/*
+ * File:   ConcurrentTimer.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 18, 2026, 10:20 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "ConcurrentTimer.h"
+#include "Calibration.h"
+
+#include <limits>
+
+#define THOUSAND    1000.0
+#define MILLION     1000000.0
+
+namespace {
+
+/* the value of a clock reading that has not been taken */
+const std::int64_t EMPTY = std::numeric_limits<std::int64_t>::min();
+
+}
+
+/*
+ * Create a new ConcurrentTimer object without any readings.
+ */
+template<class Clock>
+BasicConcurrentTimer<Clock>::BasicConcurrentTimer() :
+    mSequence(0),
+    mStartTime(EMPTY),
+    mStopTime(EMPTY){
+}
+
+/*
+ * Copy a consistent snapshot.
+ */
+template<class Clock>
+BasicConcurrentTimer<Clock>::BasicConcurrentTimer(
+        const BasicConcurrentTimer& orig) : BasicConcurrentTimer() {
+    *this = orig;
+}
+
+/*
+ * Destructor. Nothing to free.
+ */
+template<class Clock>
+BasicConcurrentTimer<Clock>::~BasicConcurrentTimer() {
+}
+
+/*
+ * Copy a consistent snapshot of rhs. The readings are stored like in reset(),
+ * so readers overlapping the copy read again.
+ */
+template<class Clock>
+BasicConcurrentTimer<Clock>&
+BasicConcurrentTimer<Clock>::operator=(const BasicConcurrentTimer& rhs) {
+    std::int64_t startTime, stopTime;
+
+    if(this == &rhs) {
+        return *this;
+    }
+
+    State state = rhs.loadSnapshot(startTime, stopTime);
+
+    this->beginWrite();
+    this->mStartTime.store(state == RESET ? EMPTY : startTime,
+        std::memory_order_relaxed);
+    this->mStopTime.store(state == STOPPED ? stopTime : EMPTY,
+        std::memory_order_relaxed);
+    this->endWrite();
+
+    return *this;
+}
+
+/*
+ * The reading is taken first. The compare-and-swap stores it only if the
+ * timer is reset, which starts the timer at the same time.
+ */
+template<class Clock>
+bool BasicConcurrentTimer<Clock>::start() {
+    std::int64_t startTime = Clock::read();
+    std::int64_t expected = EMPTY;
+
+    return this->mStartTime.compare_exchange_strong(expected, startTime,
+        std::memory_order_acq_rel, std::memory_order_acquire);
+}
+
+/*
+ * The reading is taken first. The compare-and-swap stores it only if the
+ * timer has no stop reading yet, which stops the timer at the same time. The
+ * start may have been read by another thread after this reading, so the stop
+ * is limited to the start.
+ */
+template<class Clock>
+bool BasicConcurrentTimer<Clock>::stop() {
+    std::int64_t stopTime = Clock::read();
+    std::int64_t startTime = this->mStartTime.load(std::memory_order_acquire);
+    std::int64_t expected = EMPTY;
+
+    if(startTime == EMPTY) {
+        return false;
+    }
+
+    if(stopTime < startTime) {
+        stopTime = startTime;
+    }
+
+    return this->mStopTime.compare_exchange_strong(expected, stopTime,
+        std::memory_order_acq_rel, std::memory_order_acquire);
+}
+
+/*
+ * Both readings are removed within a write of the sequence, so a reader
+ * overlapping the reset reads again.
+ */
+template<class Clock>
+void BasicConcurrentTimer<Clock>::reset() {
+    this->beginWrite();
+    this->mStartTime.store(EMPTY, std::memory_order_relaxed);
+    this->mStopTime.store(EMPTY, std::memory_order_relaxed);
+    this->endWrite();
+}
+
+/*
+ * Returns the state of a consistent snapshot.
+ */
+template<class Clock>
+typename BasicConcurrentTimer<Clock>::State
+BasicConcurrentTimer<Clock>::getState() const {
+    std::int64_t startTime, stopTime;
+
+    return this->loadSnapshot(startTime, stopTime);
+}
+
+/*
+ * Returns if the timer is running.
+ */
+template<class Clock>
+bool BasicConcurrentTimer<Clock>::isRunning() const {
+    return this->getState() == RUNNING;
+}
+
+/*
+ * Returns if the timer has been stopped.
+ */
+template<class Clock>
+bool BasicConcurrentTimer<Clock>::isStopped() const {
+    return this->getState() == STOPPED;
+}
+
+/*
+ * Returns if the timer is reset.
+ */
+template<class Clock>
+bool BasicConcurrentTimer<Clock>::isReset() const {
+    return this->getState() == RESET;
+}
+
+/*
+ * Calculates the duration from a consistent snapshot of the readings.
+ */
+template<class Clock>
+const Timestamp BasicConcurrentTimer<Clock>::getTime() const {
+    std::int64_t startTime, stopTime;
+    std::int64_t ticks;
+
+    State state = this->loadSnapshot(startTime, stopTime);
+
+    if(state == RUNNING) {
+        ticks = Clock::read() - startTime;
+    } else if(state == STOPPED) {
+        ticks = stopTime - startTime;
+    } else {
+        ticks = 0;
+    }
+
+    return Clock::toTimestamp(Calibration<Clock>::correct(ticks));
+}
+
+/*
+ * Returns the duration in seconds.
+ */
+template<class Clock>
+double BasicConcurrentTimer<Clock>::getTimeInSeconds() const {
+    return this->getTime().getTime();
+}
+
+/*
+ * Returns the duration in milliseconds.
+ */
+template<class Clock>
+double BasicConcurrentTimer<Clock>::getTimeInMilliSeconds() const {
+    return this->getTime().getTotalNanoSeconds() / MILLION;
+}
+
+/*
+ * Returns the duration in microseconds.
+ */
+template<class Clock>
+double BasicConcurrentTimer<Clock>::getTimeInMicroSeconds() const {
+    return this->getTime().getTotalNanoSeconds() / THOUSAND;
+}
+
+/*
+ * Returns the duration in nanoseconds.
+ */
+template<class Clock>
+double BasicConcurrentTimer<Clock>::getTimeInNanoSeconds() const {
+    return static_cast<double>(this->getTime().getTotalNanoSeconds());
+}
+
+/*
+ * Returns the frequency of the duration, or zero for a zero duration.
+ */
+template<class Clock>
+double BasicConcurrentTimer<Clock>::getFrequency() const {
+    double time = this->getTimeInSeconds();
+    double frequency;
+
+    if(time != 0.0) {
+        frequency = 1.0 / time;
+    } else {
+        frequency = 0.0;
+    }
+
+    return frequency;
+}
+
+/*
+ * Compares the states and the readings of snapshots of both timers.
+ */
+template<class Clock>
+bool BasicConcurrentTimer<Clock>::isEqual(
+        const BasicConcurrentTimer& rhs) const {
+    std::int64_t thisStart, rhsStart, thisStop, rhsStop;
+
+    if(this == &rhs) {
+        return true;
+    }
+
+    State thisState = this->loadSnapshot(thisStart, thisStop);
+    State rhsState = rhs.loadSnapshot(rhsStart, rhsStop);
+
+    return thisState == rhsState
+        and thisStart == rhsStart
+        and thisStop == rhsStop;
+}
+
+/*
+ * Reads a consistent snapshot and returns its start reading.
+ */
+template<class Clock>
+std::int64_t BasicConcurrentTimer<Clock>::getStartTicks() const {
+    std::int64_t start, stop;
+
+    this->loadSnapshot(start, stop);
+
+    return start;
+}
+
+/*
+ * Reads a consistent snapshot and returns its stop reading.
+ */
+template<class Clock>
+std::int64_t BasicConcurrentTimer<Clock>::getStopTicks() const {
+    std::int64_t start, stop;
+
+    this->loadSnapshot(start, stop);
+
+    return stop;
+}
+
+/*
+ * Only a stopped timer has a complete measurement.
+ */
+template<class Clock>
+BasicTimer<Clock> BasicConcurrentTimer<Clock>::toTimer() const {
+    std::int64_t startTime, stopTime;
+
+    if(this->loadSnapshot(startTime, stopTime) == STOPPED) {
+        return BasicTimer<Clock>(startTime, stopTime);
+    } else {
+        return BasicTimer<Clock>();
+    }
+}
+
+/*
+ * The sequence is odd while reset() or a copy stores both readings. The
+ * release fence keeps these stores from becoming visible before the odd
+ * sequence.
+ */
+template<class Clock>
+void BasicConcurrentTimer<Clock>::beginWrite() {
+    this->mSequence.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+/*
+ * The sequence is even again, and different from the one before the write.
+ */
+template<class Clock>
+void BasicConcurrentTimer<Clock>::endWrite() {
+    this->mSequence.fetch_add(1, std::memory_order_release);
+}
+
+/*
+ * A seqlock: the readings are used only if the sequence was even before and
+ * unchanged after reading them, i.e. no reset() or copy overlapped. The stop
+ * is read before the start. Without such a write, a stop is only stored after
+ * its start, so both readings belong to the same measurement. A stop without
+ * a start cannot be seen then. Missing readings are returned as 0.
+ */
+template<class Clock>
+typename BasicConcurrentTimer<Clock>::State
+BasicConcurrentTimer<Clock>::loadSnapshot(std::int64_t& startTime,
+        std::int64_t& stopTime) const {
+    std::uint64_t sequence;
+
+    do {
+        sequence = this->mSequence.load(std::memory_order_acquire);
+        stopTime = this->mStopTime.load(std::memory_order_acquire);
+        startTime = this->mStartTime.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while((sequence & 1) != 0
+        or sequence != this->mSequence.load(std::memory_order_relaxed));
+
+    if(startTime == EMPTY) {
+        startTime = 0;
+        stopTime = 0;
+
+        return RESET;
+    }
+
+    if(stopTime == EMPTY) {
+        stopTime = 0;
+
+        return RUNNING;
+    }
+
+    return STOPPED;
+}
+
+template class BasicConcurrentTimer<RealtimeClock>;
+template class BasicConcurrentTimer<MonotonicClock>;
+template class BasicConcurrentTimer<MonotonicRawClock>;
+template class BasicConcurrentTimer<BoottimeClock>;
+template class BasicConcurrentTimer<TscClock>;
@@ -0,0 +1,238 @@
+/*
+ * File:   ConcurrentTimer.h
+ * Author: Nils Döring
+ *
+ * Created on October 18, 2026, 10:20 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CONCURRENTTIMER_H
+#define	CONCURRENTTIMER_H
+
+#include <atomic>
+#include <cstdint>
+#include "Timestamp.h"
+#include "Clock.h"
+#include "Timer.h"
+
+/**
+ * \brief This class is a Timer that may be used by several threads at once.
+ *
+ * A ConcurrentTimer can be started on one thread and stopped on another, e.g.
+ * to measure a request accepted on an I/O thread and completed on a worker.
+ * Its state is an atomic state machine:
+ *
+ * RESET -> RUNNING -> STOPPED -> RESET
+ *
+ * The state is given by the two clock readings, each of them is empty or
+ * holds a reading. start() and stop() read the clock first and store the
+ * reading with a single compare-and-swap, which switches the state at the same
+ * time. So no thread ever waits for another one. If several threads call
+ * start() or stop() concurrently, exactly one of them succeeds and returns
+ * true, all others return false and change nothing. Reading the duration is
+ * consistent as well: a reader never sees the start of one measurement and the
+ * stop of another.
+ *
+ * ConcurrentTimer can be stored in a Timerseries. The timers contained may be
+ * started and stopped by any thread, as long as the series itself is not
+ * modified at the same time.
+ *
+ * \attention A ConcurrentTimer cannot be paused.
+ * \attention Use a clock that is consistent across threads, i.e. not
+ * ThreadCpuClock.
+ * \tparam Clock One of the wall-clock policies defined in Clock.h.
+ */
+template<class Clock>
+class BasicConcurrentTimer {
+public:
+    /**
+     * \brief The states of a ConcurrentTimer.
+     */
+    enum State {RESET, RUNNING, STOPPED};
+
+    /**
+     * \brief Default constructor.
+     *
+     * Creates a ConcurrentTimer in the state RESET.
+     */
+    BasicConcurrentTimer();
+
+    /**
+     * \brief Copy constructor.
+     *
+     * Copies a consistent snapshot of the original timer. A timer that is
+     * running in the original keeps running in the copy.
+     * @param orig
+     */
+    BasicConcurrentTimer(const BasicConcurrentTimer& orig);
+
+    /**
+     * \brief Standard destructor.
+     */
+    virtual ~BasicConcurrentTimer();
+
+    /**
+     * \brief Assign a consistent snapshot of the other timer to this object.
+     *
+     * \attention The assignment itself must not race with other operations on
+     * this object.
+     * @param rhs
+     */
+    BasicConcurrentTimer& operator=(const BasicConcurrentTimer& rhs);
+
+    /**
+     * \brief Start the timer.
+     *
+     * The clock is read before the state is changed. Returns true, if this
+     * call started the timer. Returns false, if the timer is not reset or
+     * another thread started it first.
+     */
+    bool start();
+
+    /**
+     * \brief Stop the timer.
+     *
+     * The clock is read before the state is changed, so the duration does not
+     * include the time spent on contention. Returns true, if this call stopped
+     * the timer. Returns false, if the timer is not running or another thread
+     * stopped it first.
+     */
+    bool stop();
+
+    /**
+     * \brief Reset the timer.
+     *
+     * Readers may run concurrently and see the timer either before or after
+     * the reset.
+     *
+     * \attention The reset must not race with start() or stop() on this
+     * object.
+     */
+    void reset();
+
+    /**
+     * \brief Returns the current state.
+     */
+    State getState() const;
+
+    /**
+     * \brief Return if the timer is running.
+     */
+    bool isRunning() const;
+
+    /**
+     * \brief Return if the timer has been stopped.
+     */
+    bool isStopped() const;
+
+    /**
+     * \brief Return if the timer is reset.
+     */
+    bool isReset() const;
+
+    /**
+     * \brief Returns the duration.
+     *
+     * The duration of a running timer is the time since the start. A reset
+     * timer has a duration of zero.
+     */
+    const Timestamp getTime() const;
+
+    /**
+     * \brief Returns the duration in seconds.
+     */
+    double getTimeInSeconds() const;
+
+    /**
+     * \brief Returns the duration in milliseconds.
+     */
+    double getTimeInMilliSeconds() const;
+
+    /**
+     * \brief Returns the duration in microseconds.
+     */
+    double getTimeInMicroSeconds() const;
+
+    /**
+     * \brief Returns the duration in nanoseconds.
+     */
+    double getTimeInNanoSeconds() const;
+
+    /**
+     * \brief Returns the frequency resulting from the duration.
+     */
+    double getFrequency() const;
+
+    /**
+     * \brief Checks whether both timers are in the same state with the same
+     * clock readings.
+     * @param rhs
+     */
+    bool isEqual(const BasicConcurrentTimer& rhs) const;
+
+    /**
+     * \brief Returns the raw clock reading taken by start().
+     *
+     * Returns 0, if the timer is reset.
+     */
+    std::int64_t getStartTicks() const;
+
+    /**
+     * \brief Returns the raw clock reading taken by stop().
+     *
+     * Returns 0, if the timer has not been stopped.
+     */
+    std::int64_t getStopTicks() const;
+
+    /**
+     * \brief Returns a Timer with the readings of a stopped timer.
+     *
+     * Returns a reset Timer, if this timer has not been stopped.
+     */
+    BasicTimer<Clock> toTimer() const;
+
+private:
+    void beginWrite();
+    void endWrite();
+    State loadSnapshot(std::int64_t& startTime, std::int64_t& stopTime) const;
+
+    /* odd during reset() and copies, so readers notice them, see seqlock */
+    std::atomic<std::uint64_t> mSequence;
+    std::atomic<std::int64_t> mStartTime;
+    std::atomic<std::int64_t> mStopTime;
+};
+
+/**
+ * \brief The default ConcurrentTimer, measuring with the monotonic clock.
+ */
+typedef BasicConcurrentTimer<MonotonicClock> ConcurrentTimer;
+
+#endif	/* CONCURRENTTIMER_H */
@@ -0,0 +1,485 @@
+/*
+ * File:   ContiguousTimerseries.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 18, 2026, 2:30 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "ContiguousTimerseries.h"
+#include "Calibration.h"
+
+#include <algorithm>
+#include <utility>
+
+#define THOUSAND    1000.0
+#define MILLION     1000000.0
+#define BILLION     1000000000.0
+
+/*
+ * Create an empty series.
+ */
+template<class Clock>
+BasicContiguousTimerseries<Clock>::BasicContiguousTimerseries() :
+    mStartTimes(),
+    mStopTimes(){
+}
+
+/*
+ * Copy both arrays.
+ */
+template<class Clock>
+BasicContiguousTimerseries<Clock>::BasicContiguousTimerseries(
+        const BasicContiguousTimerseries& orig) :
+    mStartTimes(orig.mStartTimes),
+    mStopTimes(orig.mStopTimes){
+}
+
+/*
+ * Move both arrays.
+ */
+template<class Clock>
+BasicContiguousTimerseries<Clock>::BasicContiguousTimerseries(
+        BasicContiguousTimerseries&& orig) :
+    mStartTimes(std::move(orig.mStartTimes)),
+    mStopTimes(std::move(orig.mStopTimes)){
+    orig.mStartTimes.clear();
+    orig.mStopTimes.clear();
+}
+
+/*
+ * Destructor. The arrays free themselves.
+ */
+template<class Clock>
+BasicContiguousTimerseries<Clock>::~BasicContiguousTimerseries() {
+}
+
+/*
+ * Copy both arrays.
+ */
+template<class Clock>
+BasicContiguousTimerseries<Clock>&
+BasicContiguousTimerseries<Clock>::operator=(
+        const BasicContiguousTimerseries& rhs) {
+    this->mStartTimes = rhs.mStartTimes;
+    this->mStopTimes = rhs.mStopTimes;
+
+    return *this;
+}
+
+/*
+ * Move both arrays.
+ */
+template<class Clock>
+BasicContiguousTimerseries<Clock>&
+BasicContiguousTimerseries<Clock>::operator=(
+        BasicContiguousTimerseries&& rhs) {
+    if(this != &rhs) {
+        this->mStartTimes = std::move(rhs.mStartTimes);
+        this->mStopTimes = std::move(rhs.mStopTimes);
+
+        rhs.mStartTimes.clear();
+        rhs.mStopTimes.clear();
+    }
+
+    return *this;
+}
+
+/*
+ * Append both arrays of rhs. Appending a series to itself doubles it.
+ */
+template<class Clock>
+BasicContiguousTimerseries<Clock>&
+BasicContiguousTimerseries<Clock>::operator+=(
+        const BasicContiguousTimerseries& rhs) {
+    std::size_t size = rhs.mStartTimes.size();
+
+    this->reserve(this->mStartTimes.size() + size);
+
+    for(std::size_t i = 0; i < size; ++i) {
+        this->mStartTimes.push_back(rhs.mStartTimes[i]);
+        this->mStopTimes.push_back(rhs.mStopTimes[i]);
+    }
+
+    return *this;
+}
+
+/*
+ * The stop reading is the start plus the elapsed ticks, so the paused time is
+ * left out. Timers that are reset or still running are skipped.
+ */
+template<class Clock>
+BasicContiguousTimerseries<Clock>&
+BasicContiguousTimerseries<Clock>::operator+=(const BasicTimer<Clock>& timer) {
+    if(timer.isRunning() or timer.isReset()) {
+        return *this;
+    }
+
+    std::int64_t startTime = timer.getStartTicks();
+
+    this->append(startTime, startTime + timer.getElapsedTicks());
+
+    return *this;
+}
+
+/*
+ * Copy both readings of the FastTimer.
+ */
+template<class Clock>
+BasicContiguousTimerseries<Clock>&
+BasicContiguousTimerseries<Clock>::operator+=(
+        const BasicFastTimer<Clock>& timer) {
+    this->append(timer.getStartTime(), timer.getStopTime());
+
+    return *this;
+}
+
+/*
+ * Sort the pairs of readings of both series and compare them.
+ */
+template<class Clock>
+bool BasicContiguousTimerseries<Clock>::operator==(
+        const BasicContiguousTimerseries& rhs) const {
+    if(this == &rhs) {
+        return true;
+    }
+
+    if(this->mStartTimes.size() != rhs.mStartTimes.size()) {
+        return false;
+    }
+
+    std::size_t size = this->mStartTimes.size();
+    std::vector<std::pair<std::int64_t, std::int64_t> > thisPairs, rhsPairs;
+
+    thisPairs.reserve(size);
+    rhsPairs.reserve(size);
+
+    for(std::size_t i = 0; i < size; ++i) {
+        thisPairs.push_back(
+            std::make_pair(this->mStartTimes[i], this->mStopTimes[i]));
+        rhsPairs.push_back(
+            std::make_pair(rhs.mStartTimes[i], rhs.mStopTimes[i]));
+    }
+
+    std::sort(thisPairs.begin(), thisPairs.end());
+    std::sort(rhsPairs.begin(), rhsPairs.end());
+
+    return thisPairs == rhsPairs;
+}
+
+/*
+ * Uses the check for equality.
+ */
+template<class Clock>
+bool BasicContiguousTimerseries<Clock>::operator!=(
+        const BasicContiguousTimerseries& rhs) const {
+    return !(*this == rhs);
+}
+
+/*
+ * Append one reading to each array.
+ */
+template<class Clock>
+void BasicContiguousTimerseries<Clock>::append(std::int64_t startTime,
+        std::int64_t stopTime) {
+    this->mStartTimes.push_back(startTime);
+    this->mStopTimes.push_back(stopTime);
+}
+
+/*
+ * Reserve the space in both arrays.
+ */
+template<class Clock>
+void BasicContiguousTimerseries<Clock>::reserve(std::size_t size) {
+    this->mStartTimes.reserve(size);
+    this->mStopTimes.reserve(size);
+}
+
+/*
+ * Remove all readings, but keep the memory.
+ */
+template<class Clock>
+void BasicContiguousTimerseries<Clock>::clear() {
+    this->mStartTimes.clear();
+    this->mStopTimes.clear();
+}
+
+/*
+ * Returns the number of measurements.
+ */
+template<class Clock>
+int BasicContiguousTimerseries<Clock>::getSize() const {
+    return static_cast<int>(this->mStartTimes.size());
+}
+
+/*
+ * Both arrays always have the same capacity, since they are reserved together.
+ */
+template<class Clock>
+std::size_t BasicContiguousTimerseries<Clock>::getCapacity() const {
+    return std::min(this->mStartTimes.capacity(),
+        this->mStopTimes.capacity());
+}
+
+/*
+ * Returns the array of start readings.
+ */
+template<class Clock>
+const std::int64_t* BasicContiguousTimerseries<Clock>::getStartTimes() const {
+    return this->mStartTimes.data();
+}
+
+/*
+ * Returns the array of stop readings.
+ */
+template<class Clock>
+const std::int64_t* BasicContiguousTimerseries<Clock>::getStopTimes() const {
+    return this->mStopTimes.data();
+}
+
+/*
+ * Creates a stopped Timer with the readings at the index.
+ */
+template<class Clock>
+BasicTimer<Clock>
+BasicContiguousTimerseries<Clock>::getTimer(std::size_t index) const {
+    return BasicTimer<Clock>(this->mStartTimes[index],
+        this->mStopTimes[index]);
+}
+
+/*
+ * Returns the duration at the index, corrected like Timer::getTime().
+ */
+template<class Clock>
+const Timestamp
+BasicContiguousTimerseries<Clock>::getTime(std::size_t index) const {
+    std::int64_t ticks = Calibration<Clock>::correct(
+        this->mStopTimes[index] - this->mStartTimes[index]);
+
+    return Clock::toTimestamp(ticks);
+}
+
+/*
+ * Returns a new list with the duration of each measurement.
+ */
+template<class Clock>
+std::list<Timestamp>* BasicContiguousTimerseries<Clock>::getTimes() const {
+    std::list<Timestamp>* times = new std::list<Timestamp>();
+    std::size_t size = this->mStartTimes.size();
+
+    for(std::size_t i = 0; i < size; ++i) {
+        times->push_back(this->getTime(i));
+    }
+
+    return times;
+}
+
+/*
+ * Returns the durations in seconds.
+ */
+template<class Clock>
+std::list<double>*
+BasicContiguousTimerseries<Clock>::getTimesInSeconds() const {
+    return this->getTimesScaled(BILLION);
+}
+
+/*
+ * Returns the durations in milliseconds.
+ */
+template<class Clock>
+std::list<double>*
+BasicContiguousTimerseries<Clock>::getTimesInMilliSeconds() const {
+    return this->getTimesScaled(MILLION);
+}
+
+/*
+ * Returns the durations in microseconds.
+ */
+template<class Clock>
+std::list<double>*
+BasicContiguousTimerseries<Clock>::getTimesInMicroSeconds() const {
+    return this->getTimesScaled(THOUSAND);
+}
+
+/*
+ * Returns the durations in nanoseconds.
+ */
+template<class Clock>
+std::list<double>*
+BasicContiguousTimerseries<Clock>::getTimesInNanoSeconds() const {
+    return this->getTimesScaled(1.0);
+}
+
+/*
+ * Returns the frequency of each measurement, or zero for a zero duration.
+ */
+template<class Clock>
+std::list<double>* BasicContiguousTimerseries<Clock>::getFrequencies() const {
+    std::list<double>* frequencies = new std::list<double>();
+    std::size_t size = this->mStartTimes.size();
+
+    for(std::size_t i = 0; i < size; ++i) {
+        double time = this->getTime(i).getTime();
+
+        frequencies->push_back(time != 0.0 ? 1.0 / time : 0.0);
+    }
+
+    return frequencies;
+}
+
+/*
+ * Scan both arrays once and divide each duration in nanoseconds by the
+ * divisor.
+ */
+template<class Clock>
+std::list<double>*
+BasicContiguousTimerseries<Clock>::getTimesScaled(double divisor) const {
+    std::list<double>* times = new std::list<double>();
+    std::size_t size = this->mStartTimes.size();
+
+    for(std::size_t i = 0; i < size; ++i) {
+        times->push_back(this->getTime(i).getTotalNanoSeconds() / divisor);
+    }
+
+    return times;
+}
+
+/*
+ * Copies the durations in seconds without allocating.
+ */
+template<class Clock>
+std::size_t
+BasicContiguousTimerseries<Clock>::getTimesInSeconds(double* buffer,
+        std::size_t size) const {
+    return copyView(this->viewTimesInSeconds(), buffer, size);
+}
+
+/*
+ * Copies the durations in milliseconds without allocating.
+ */
+template<class Clock>
+std::size_t
+BasicContiguousTimerseries<Clock>::getTimesInMilliSeconds(double* buffer,
+        std::size_t size) const {
+    return copyView(this->viewTimesInMilliSeconds(), buffer, size);
+}
+
+/*
+ * Copies the durations in microseconds without allocating.
+ */
+template<class Clock>
+std::size_t
+BasicContiguousTimerseries<Clock>::getTimesInMicroSeconds(double* buffer,
+        std::size_t size) const {
+    return copyView(this->viewTimesInMicroSeconds(), buffer, size);
+}
+
+/*
+ * Copies the durations in nanoseconds without allocating.
+ */
+template<class Clock>
+std::size_t
+BasicContiguousTimerseries<Clock>::getTimesInNanoSeconds(double* buffer,
+        std::size_t size) const {
+    return copyView(this->viewTimesInNanoSeconds(), buffer, size);
+}
+
+/*
+ * Copies the frequencies without allocating.
+ */
+template<class Clock>
+std::size_t BasicContiguousTimerseries<Clock>::getFrequencies(double* buffer,
+        std::size_t size) const {
+    return copyView(this->viewFrequencies(), buffer, size);
+}
+
+/*
+ * The view reads directly from both arrays.
+ */
+template<class Clock>
+ReadingsView<Clock> BasicContiguousTimerseries<Clock>::view(
+        typename ReadingsView<Clock>::Unit unit) const {
+    return ReadingsView<Clock>(this->mStartTimes.data(),
+        this->mStopTimes.data(), this->mStartTimes.size(), unit);
+}
+
+/*
+ * Returns a view on the durations in seconds.
+ */
+template<class Clock>
+ReadingsView<Clock>
+BasicContiguousTimerseries<Clock>::viewTimesInSeconds() const {
+    return this->view(ReadingsView<Clock>::SECONDS);
+}
+
+/*
+ * Returns a view on the durations in milliseconds.
+ */
+template<class Clock>
+ReadingsView<Clock>
+BasicContiguousTimerseries<Clock>::viewTimesInMilliSeconds() const {
+    return this->view(ReadingsView<Clock>::MILLISECONDS);
+}
+
+/*
+ * Returns a view on the durations in microseconds.
+ */
+template<class Clock>
+ReadingsView<Clock>
+BasicContiguousTimerseries<Clock>::viewTimesInMicroSeconds() const {
+    return this->view(ReadingsView<Clock>::MICROSECONDS);
+}
+
+/*
+ * Returns a view on the durations in nanoseconds.
+ */
+template<class Clock>
+ReadingsView<Clock>
+BasicContiguousTimerseries<Clock>::viewTimesInNanoSeconds() const {
+    return this->view(ReadingsView<Clock>::NANOSECONDS);
+}
+
+/*
+ * Returns a view on the frequencies.
+ */
+template<class Clock>
+ReadingsView<Clock>
+BasicContiguousTimerseries<Clock>::viewFrequencies() const {
+    return this->view(ReadingsView<Clock>::HERTZ);
+}
+
+template class BasicContiguousTimerseries<RealtimeClock>;
+template class BasicContiguousTimerseries<MonotonicClock>;
+template class BasicContiguousTimerseries<MonotonicRawClock>;
+template class BasicContiguousTimerseries<BoottimeClock>;
+template class BasicContiguousTimerseries<ProcessCpuClock>;
+template class BasicContiguousTimerseries<ThreadCpuClock>;
+template class BasicContiguousTimerseries<TscClock>;
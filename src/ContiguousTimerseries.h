@@ -0,0 +1,328 @@
+/*
+ * File:   ContiguousTimerseries.h
+ * Author: Nils Döring
+ *
+ * Created on October 18, 2026, 2:30 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CONTIGUOUSTIMERSERIES_H
+#define	CONTIGUOUSTIMERSERIES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <vector>
+#include "Timestamp.h"
+#include "Clock.h"
+#include "Timer.h"
+#include "FastTimer.h"
+#include "TimeView.h"
+
+/**
+ * \brief This class stores a series of measurements in contiguous arrays.
+ *
+ * Unlike Timerseries, which holds a heap allocated Timer per measurement in a
+ * list, a ContiguousTimerseries only stores the start and stop readings of the
+ * clock, each in its own growable array. A measurement takes 16 bytes and no
+ * allocation except for the occasional growth of the arrays. All conversions
+ * are linear scans over the arrays.
+ *
+ * Only completed measurements are stored. The paused time of a Timer is
+ * removed by moving its stop reading towards the start.
+ *
+ * \attention This class is \b NOT reentrant and \b NOT thread-safe.
+ * \tparam Clock One of the clock policies defined in Clock.h.
+ */
+template<class Clock>
+class BasicContiguousTimerseries {
+public:
+    /**
+     * \brief Default constructor.
+     *
+     * Creates an empty series.
+     */
+    BasicContiguousTimerseries();
+
+    /**
+     * \brief Copy constructor.
+     * @param orig
+     */
+    BasicContiguousTimerseries(const BasicContiguousTimerseries& orig);
+
+    /**
+     * \brief Move constructor.
+     *
+     * Takes over the arrays of orig, which is empty afterwards.
+     * @param orig
+     */
+    BasicContiguousTimerseries(BasicContiguousTimerseries&& orig);
+
+    /**
+     * \brief Standard destructor.
+     */
+    virtual ~BasicContiguousTimerseries();
+
+    /**
+     * \brief Assign the measurements of the other series to this object.
+     * @param rhs
+     */
+    BasicContiguousTimerseries& operator=(
+        const BasicContiguousTimerseries& rhs);
+
+    /**
+     * \brief Take over the measurements of the other series.
+     *
+     * rhs is empty afterwards.
+     * @param rhs
+     */
+    BasicContiguousTimerseries& operator=(BasicContiguousTimerseries&& rhs);
+
+    /**
+     * \brief Appends all measurements of the other series.
+     * @param rhs
+     */
+    BasicContiguousTimerseries& operator+=(
+        const BasicContiguousTimerseries& rhs);
+
+    /**
+     * \brief Appends the measurement of a Timer.
+     *
+     * The Timer is not stored, only its readings are copied. A Timer that is
+     * reset or still running has no completed measurement and is skipped.
+     * @param timer
+     */
+    BasicContiguousTimerseries& operator+=(const BasicTimer<Clock>& timer);
+
+    /**
+     * \brief Appends the measurement of a FastTimer.
+     * @param timer
+     */
+    BasicContiguousTimerseries& operator+=(const BasicFastTimer<Clock>& timer);
+
+    /**
+     * \brief Checks if both series contain the same measurements.
+     *
+     * Like Timerseries, the order of the measurements does not matter.
+     * @param rhs
+     */
+    bool operator==(const BasicContiguousTimerseries& rhs) const;
+
+    /**
+     * \brief Checks if the series differ, see operator==.
+     * @param rhs
+     */
+    bool operator!=(const BasicContiguousTimerseries& rhs) const;
+
+    /**
+     * \brief Appends a measurement given by two raw readings of the clock.
+     * @param startTime
+     * @param stopTime
+     */
+    void append(std::int64_t startTime, std::int64_t stopTime);
+
+    /**
+     * \brief Reserves space for the given number of measurements.
+     *
+     * Reserve the expected size in advance to avoid the growth of the arrays
+     * while measuring.
+     * @param size
+     */
+    void reserve(std::size_t size);
+
+    /**
+     * \brief Removes all measurements.
+     *
+     * The memory is kept for the next measurements.
+     */
+    void clear();
+
+    /**
+     * \brief Returns the number of measurements.
+     */
+    int getSize() const;
+
+    /**
+     * \brief Returns the number of measurements that fit without growing.
+     */
+    std::size_t getCapacity() const;
+
+    /**
+     * \brief Returns the start readings of all measurements.
+     *
+     * The array has getSize() elements. It is invalidated by every
+     * modification of the series.
+     */
+    const std::int64_t* getStartTimes() const;
+
+    /**
+     * \brief Returns the stop readings of all measurements.
+     *
+     * See getStartTimes().
+     */
+    const std::int64_t* getStopTimes() const;
+
+    /**
+     * \brief Returns the measurement at the given index as Timer.
+     * @param index
+     */
+    BasicTimer<Clock> getTimer(std::size_t index) const;
+
+    /**
+     * \brief Returns the duration at the given index.
+     * @param index
+     */
+    const Timestamp getTime(std::size_t index) const;
+
+    /**
+     * \brief Get the Timestamps with the durations of all measurements.
+     */
+    std::list<Timestamp>* getTimes() const;
+
+    /**
+     * \brief Returns the durations of all measurements in seconds.
+     */
+    std::list<double>* getTimesInSeconds() const;
+
+    /**
+     * \brief Returns the durations of all measurements in milliseconds.
+     */
+    std::list<double>* getTimesInMilliSeconds() const;
+
+    /**
+     * \brief Returns the durations of all measurements in microseconds.
+     */
+    std::list<double>* getTimesInMicroSeconds() const;
+
+    /**
+     * \brief Returns the durations of all measurements in nanoseconds.
+     */
+    std::list<double>* getTimesInNanoSeconds() const;
+
+    /**
+     * \brief Returns the frequencies of all measurements.
+     */
+    std::list<double>* getFrequencies() const;
+
+    /**
+     * \brief Copies the first durations in seconds into the buffer.
+     *
+     * Copies at most size durations and returns the number copied. This does
+     * not allocate.
+     * @param buffer
+     * @param size The number of elements fitting into the buffer
+     */
+    std::size_t getTimesInSeconds(double* buffer, std::size_t size) const;
+
+    /**
+     * \brief Copies the first durations in milliseconds into the buffer.
+     *
+     * See getTimesInSeconds(double*, std::size_t).
+     * @param buffer
+     * @param size
+     */
+    std::size_t getTimesInMilliSeconds(double* buffer, std::size_t size) const;
+
+    /**
+     * \brief Copies the first durations in microseconds into the buffer.
+     *
+     * See getTimesInSeconds(double*, std::size_t).
+     * @param buffer
+     * @param size
+     */
+    std::size_t getTimesInMicroSeconds(double* buffer, std::size_t size) const;
+
+    /**
+     * \brief Copies the first durations in nanoseconds into the buffer.
+     *
+     * See getTimesInSeconds(double*, std::size_t).
+     * @param buffer
+     * @param size
+     */
+    std::size_t getTimesInNanoSeconds(double* buffer, std::size_t size) const;
+
+    /**
+     * \brief Copies the first frequencies into the buffer.
+     *
+     * See getTimesInSeconds(double*, std::size_t).
+     * @param buffer
+     * @param size
+     */
+    std::size_t getFrequencies(double* buffer, std::size_t size) const;
+
+    /**
+     * \brief Returns a lazy view on all measurements in the given unit.
+     *
+     * The values are computed from the stored readings while iterating.
+     * The view is invalidated by appending to this series.
+     * @param unit
+     */
+    ReadingsView<Clock> view(typename ReadingsView<Clock>::Unit unit) const;
+
+    /**
+     * \brief Returns a lazy view on the durations in seconds.
+     */
+    ReadingsView<Clock> viewTimesInSeconds() const;
+
+    /**
+     * \brief Returns a lazy view on the durations in milliseconds.
+     */
+    ReadingsView<Clock> viewTimesInMilliSeconds() const;
+
+    /**
+     * \brief Returns a lazy view on the durations in microseconds.
+     */
+    ReadingsView<Clock> viewTimesInMicroSeconds() const;
+
+    /**
+     * \brief Returns a lazy view on the durations in nanoseconds.
+     */
+    ReadingsView<Clock> viewTimesInNanoSeconds() const;
+
+    /**
+     * \brief Returns a lazy view on the frequencies.
+     */
+    ReadingsView<Clock> viewFrequencies() const;
+
+private:
+    std::list<double>* getTimesScaled(double divisor) const;
+
+    std::vector<std::int64_t> mStartTimes;
+    std::vector<std::int64_t> mStopTimes;
+};
+
+/**
+ * \brief The default ContiguousTimerseries, holding measurements of the
+ * monotonic clock.
+ */
+typedef BasicContiguousTimerseries<MonotonicClock> ContiguousTimerseries;
+
+#endif	/* CONTIGUOUSTIMERSERIES_H */
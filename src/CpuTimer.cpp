@@ -0,0 +1,283 @@
+/*
+ * File:   CpuTimer.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 17, 2026, 11:00 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "CpuTimer.h"
+
+/*
+ * Create a new CpuTimer object. The clock readings are set to zero.
+ */
+template<class Clock>
+BasicCpuTimer<Clock>::BasicCpuTimer() :
+    mWallTimer(),
+    mCpuTimer(){
+}
+
+/*
+ * Create a new object and copy the readings and the state of both timers.
+ */
+template<class Clock>
+BasicCpuTimer<Clock>::BasicCpuTimer(const BasicCpuTimer& orig) :
+    mWallTimer(orig.mWallTimer),
+    mCpuTimer(orig.mCpuTimer){
+}
+
+/*
+ * Destructor. Nothing to free.
+ */
+template<class Clock>
+BasicCpuTimer<Clock>::~BasicCpuTimer() {
+}
+
+/*
+ * Assign the readings and the state of both timers.
+ */
+template<class Clock>
+BasicCpuTimer<Clock>&
+BasicCpuTimer<Clock>::operator=(const BasicCpuTimer& rhs) {
+    this->mWallTimer = rhs.mWallTimer;
+    this->mCpuTimer = rhs.mCpuTimer;
+
+    return *this;
+}
+
+/*
+ * Start the CPU timer first, so the wall-clock interval lies within the CPU
+ * interval.
+ */
+template<class Clock>
+void BasicCpuTimer<Clock>::start() {
+    this->mCpuTimer.start();
+    this->mWallTimer.start();
+}
+
+/*
+ * Stop the wall-clock timer first, see start().
+ */
+template<class Clock>
+void BasicCpuTimer<Clock>::stop() {
+    this->mWallTimer.stop();
+    this->mCpuTimer.stop();
+}
+
+/*
+ * Pause both timers, in the same order as stop().
+ */
+template<class Clock>
+void BasicCpuTimer<Clock>::pause() {
+    this->mWallTimer.pause();
+    this->mCpuTimer.pause();
+}
+
+/*
+ * Resume both timers, in the same order as start().
+ */
+template<class Clock>
+void BasicCpuTimer<Clock>::resume() {
+    this->mCpuTimer.resume();
+    this->mWallTimer.resume();
+}
+
+/*
+ * Reset both timers.
+ */
+template<class Clock>
+void BasicCpuTimer<Clock>::reset() {
+    this->mWallTimer.reset();
+    this->mCpuTimer.reset();
+}
+
+/*
+ * Both timers change their state together, so the wall-clock timer tells the
+ * state.
+ */
+template<class Clock>
+bool BasicCpuTimer<Clock>::isRunning() const {
+    return this->mWallTimer.isRunning();
+}
+
+/*
+ * See isRunning().
+ */
+template<class Clock>
+bool BasicCpuTimer<Clock>::isPaused() const {
+    return this->mWallTimer.isPaused();
+}
+
+/*
+ * See isRunning().
+ */
+template<class Clock>
+bool BasicCpuTimer<Clock>::isReset() const {
+    return this->mWallTimer.isReset();
+}
+
+/*
+ * Returns the wall-clock duration.
+ */
+template<class Clock>
+const Timestamp BasicCpuTimer<Clock>::getTime() const {
+    return this->mWallTimer.getTime();
+}
+
+/*
+ * Returns the wall-clock duration in seconds.
+ */
+template<class Clock>
+double BasicCpuTimer<Clock>::getTimeInSeconds() const {
+    return this->mWallTimer.getTimeInSeconds();
+}
+
+/*
+ * Returns the wall-clock duration in milliseconds.
+ */
+template<class Clock>
+double BasicCpuTimer<Clock>::getTimeInMilliSeconds() const {
+    return this->mWallTimer.getTimeInMilliSeconds();
+}
+
+/*
+ * Returns the wall-clock duration in microseconds.
+ */
+template<class Clock>
+double BasicCpuTimer<Clock>::getTimeInMicroSeconds() const {
+    return this->mWallTimer.getTimeInMicroSeconds();
+}
+
+/*
+ * Returns the wall-clock duration in nanoseconds.
+ */
+template<class Clock>
+double BasicCpuTimer<Clock>::getTimeInNanoSeconds() const {
+    return this->mWallTimer.getTimeInNanoSeconds();
+}
+
+/*
+ * Returns the frequency of the wall-clock duration.
+ */
+template<class Clock>
+double BasicCpuTimer<Clock>::getFrequency() const {
+    return this->mWallTimer.getFrequency();
+}
+
+/*
+ * Returns the CPU time of the thread.
+ */
+template<class Clock>
+const Timestamp BasicCpuTimer<Clock>::getCpuTime() const {
+    return this->mCpuTimer.getTime();
+}
+
+/*
+ * Returns the CPU time in seconds.
+ */
+template<class Clock>
+double BasicCpuTimer<Clock>::getCpuTimeInSeconds() const {
+    return this->mCpuTimer.getTimeInSeconds();
+}
+
+/*
+ * Returns the CPU time in milliseconds.
+ */
+template<class Clock>
+double BasicCpuTimer<Clock>::getCpuTimeInMilliSeconds() const {
+    return this->mCpuTimer.getTimeInMilliSeconds();
+}
+
+/*
+ * Returns the CPU time in microseconds.
+ */
+template<class Clock>
+double BasicCpuTimer<Clock>::getCpuTimeInMicroSeconds() const {
+    return this->mCpuTimer.getTimeInMicroSeconds();
+}
+
+/*
+ * Returns the CPU time in nanoseconds.
+ */
+template<class Clock>
+double BasicCpuTimer<Clock>::getCpuTimeInNanoSeconds() const {
+    return this->mCpuTimer.getTimeInNanoSeconds();
+}
+
+/*
+ * Divide the CPU time by the wall-clock time. The CPU clock has a coarser
+ * resolution on some systems, so the ratio may slightly exceed 1 for short
+ * durations.
+ */
+template<class Clock>
+double BasicCpuTimer<Clock>::getCpuUtilisation() const {
+    double wall = this->mWallTimer.getTimeInNanoSeconds();
+    double utilisation;
+
+    if(wall > 0.0) {
+        utilisation = this->mCpuTimer.getTimeInNanoSeconds() / wall;
+    } else {
+        utilisation = 0.0;
+    }
+
+    return utilisation;
+}
+
+/*
+ * Checks both timers, see Timer::isEqual().
+ */
+template<class Clock>
+bool BasicCpuTimer<Clock>::isEqual(const BasicCpuTimer& rhs) const {
+    return this->mWallTimer.isEqual(rhs.mWallTimer)
+        && this->mCpuTimer.isEqual(rhs.mCpuTimer);
+}
+
+/*
+ * Returns the wall-clock timer.
+ */
+template<class Clock>
+const BasicTimer<Clock>& BasicCpuTimer<Clock>::getWallTimer() const {
+    return this->mWallTimer;
+}
+
+/*
+ * Returns the CPU timer.
+ */
+template<class Clock>
+const BasicTimer<ThreadCpuClock>& BasicCpuTimer<Clock>::getCpuTimer() const {
+    return this->mCpuTimer;
+}
+
+template class BasicCpuTimer<RealtimeClock>;
+template class BasicCpuTimer<MonotonicClock>;
+template class BasicCpuTimer<MonotonicRawClock>;
+template class BasicCpuTimer<BoottimeClock>;
+template class BasicCpuTimer<TscClock>;
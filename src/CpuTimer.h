@@ -0,0 +1,229 @@
+/*
+ * File:   CpuTimer.h
+ * Author: Nils Döring
+ *
+ * Created on October 17, 2026, 11:00 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CPUTIMER_H
+#define	CPUTIMER_H
+
+#include "Timestamp.h"
+#include "Clock.h"
+#include "Timer.h"
+
+/**
+ * \brief This class measures wall-clock time and CPU time at once.
+ *
+ * A CpuTimer combines a Timer on the given wall clock with a Timer on
+ * ThreadCpuClock, which counts only the time the calling thread has been
+ * executed. Comparing both shows whether a long duration was spent computing
+ * or waiting, e.g. for the scheduler, for locks or for I/O. getTime() and the
+ * related methods return the wall-clock time, getCpuTime() and the related
+ * methods the CPU time.
+ *
+ * The CPU clock is read first on start() and last on stop(), so the wall-clock
+ * interval lies within the CPU interval.
+ *
+ * \attention The CPU time is the one of the calling thread. Start and stop a
+ * CpuTimer on the same thread.
+ * \attention This class is \b NOT reentrant and \b NOT thread-safe.
+ * \tparam Clock One of the wall-clock policies defined in Clock.h.
+ */
+template<class Clock>
+class BasicCpuTimer {
+public:
+    /**
+     * \brief Default constructor.
+     *
+     * Creates a CpuTimer whose clock readings are set to zero.
+     */
+    BasicCpuTimer();
+
+    /**
+     * \brief Copy constructor.
+     * @param orig
+     */
+    BasicCpuTimer(const BasicCpuTimer& orig);
+
+    /**
+     * \brief Standard destructor.
+     */
+    virtual ~BasicCpuTimer();
+
+    /**
+     * \brief Assign the values of the other CpuTimer to this object.
+     * @param rhs
+     */
+    BasicCpuTimer& operator=(const BasicCpuTimer& rhs);
+
+    /**
+     * \brief Start the timer.
+     *
+     * \attention This method fails silently, like Timer::start().
+     */
+    void start();
+
+    /**
+     * \brief Stop a running timer.
+     *
+     * \attention This method fails silently, like Timer::stop().
+     */
+    void stop();
+
+    /**
+     * \brief Pause a running timer.
+     *
+     * \attention This method fails silently, like Timer::pause().
+     */
+    void pause();
+
+    /**
+     * \brief Resume a paused timer.
+     *
+     * \attention This method fails silently, like Timer::resume().
+     */
+    void resume();
+
+    /**
+     * \brief Reset the timer.
+     */
+    void reset();
+
+    /**
+     * \brief Return if the timer is running.
+     */
+    bool isRunning() const;
+
+    /**
+     * \brief Return if the timer is paused.
+     */
+    bool isPaused() const;
+
+    /**
+     * \brief Return if the timer is reset.
+     */
+    bool isReset() const;
+
+    /**
+     * \brief Returns the wall-clock duration.
+     */
+    const Timestamp getTime() const;
+
+    /**
+     * \brief Returns the wall-clock duration in seconds.
+     */
+    double getTimeInSeconds() const;
+
+    /**
+     * \brief Returns the wall-clock duration in milliseconds.
+     */
+    double getTimeInMilliSeconds() const;
+
+    /**
+     * \brief Returns the wall-clock duration in microseconds.
+     */
+    double getTimeInMicroSeconds() const;
+
+    /**
+     * \brief Returns the wall-clock duration in nanoseconds.
+     */
+    double getTimeInNanoSeconds() const;
+
+    /**
+     * \brief Returns the frequency resulting from the wall-clock duration.
+     */
+    double getFrequency() const;
+
+    /**
+     * \brief Returns the CPU time of the thread.
+     */
+    const Timestamp getCpuTime() const;
+
+    /**
+     * \brief Returns the CPU time in seconds.
+     */
+    double getCpuTimeInSeconds() const;
+
+    /**
+     * \brief Returns the CPU time in milliseconds.
+     */
+    double getCpuTimeInMilliSeconds() const;
+
+    /**
+     * \brief Returns the CPU time in microseconds.
+     */
+    double getCpuTimeInMicroSeconds() const;
+
+    /**
+     * \brief Returns the CPU time in nanoseconds.
+     */
+    double getCpuTimeInNanoSeconds() const;
+
+    /**
+     * \brief Returns the ratio of CPU time to wall-clock time.
+     *
+     * A value close to 1 means the thread was computing all the time, a value
+     * close to 0 means it was waiting. Returns 0, if there is no wall-clock
+     * time measured.
+     */
+    double getCpuUtilisation() const;
+
+    /**
+     * \brief Checks whether both timers have the same readings.
+     *
+     * See Timer::isEqual(). Both the wall clock and the CPU clock are checked.
+     * @param rhs
+     */
+    bool isEqual(const BasicCpuTimer& rhs) const;
+
+    /**
+     * \brief Returns the Timer measuring the wall-clock time.
+     */
+    const BasicTimer<Clock>& getWallTimer() const;
+
+    /**
+     * \brief Returns the Timer measuring the CPU time.
+     */
+    const BasicTimer<ThreadCpuClock>& getCpuTimer() const;
+
+private:
+    BasicTimer<Clock> mWallTimer;
+    BasicTimer<ThreadCpuClock> mCpuTimer;
+};
+
+/**
+ * \brief The default CpuTimer, measuring the wall-clock time with the
+ * monotonic clock.
+ */
+typedef BasicCpuTimer<MonotonicClock> CpuTimer;
+
+#endif	/* CPUTIMER_H */
@@ -0,0 +1,187 @@
+/*
+ * File:   CpuTimerseries.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 17, 2026, 11:40 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "CpuTimerseries.h"
+
+#include <utility>
+
+/*
+ * Creates an empty series.
+ */
+template<class Clock>
+BasicCpuTimerseries<Clock>::BasicCpuTimerseries() :
+    BasicTimerseries<Clock, BasicCpuTimer<Clock> >(){
+}
+
+/*
+ * Copies all CpuTimer of the original series.
+ */
+template<class Clock>
+BasicCpuTimerseries<Clock>::BasicCpuTimerseries(
+        const BasicCpuTimerseries& orig) :
+    BasicTimerseries<Clock, BasicCpuTimer<Clock> >(orig){
+}
+
+/*
+ * Takes over all CpuTimer of the original series.
+ */
+template<class Clock>
+BasicCpuTimerseries<Clock>::BasicCpuTimerseries(
+        BasicCpuTimerseries&& orig) :
+    BasicTimerseries<Clock, BasicCpuTimer<Clock> >(std::move(orig)){
+}
+
+/*
+ * Copies all CpuTimer of rhs, see Timerseries::operator=().
+ */
+template<class Clock>
+BasicCpuTimerseries<Clock>& BasicCpuTimerseries<Clock>::operator=(
+        const BasicCpuTimerseries& rhs) {
+    BasicTimerseries<Clock, BasicCpuTimer<Clock> >::operator=(rhs);
+
+    return *this;
+}
+
+/*
+ * Takes over all CpuTimer of rhs, see Timerseries::operator=().
+ */
+template<class Clock>
+BasicCpuTimerseries<Clock>& BasicCpuTimerseries<Clock>::operator=(
+        BasicCpuTimerseries&& rhs) {
+    BasicTimerseries<Clock, BasicCpuTimer<Clock> >::operator=(std::move(rhs));
+
+    return *this;
+}
+
+/*
+ * The CpuTimer are destroyed by the base class.
+ */
+template<class Clock>
+BasicCpuTimerseries<Clock>::~BasicCpuTimerseries() {
+}
+
+/*
+ * Returns a new list with the CPU time of each CpuTimer.
+ */
+template<class Clock>
+std::list<Timestamp>* BasicCpuTimerseries<Clock>::getCpuTimes() const {
+    std::list<Timestamp>* times = new std::list<Timestamp>();
+
+    for(const BasicCpuTimer<Clock>* timer: this->getTimer()){
+        times->push_back(timer->getCpuTime());
+    }
+
+    return times;
+}
+
+/*
+ * Returns the CPU times in seconds, see getTimesInSeconds().
+ */
+template<class Clock>
+std::list<double>* BasicCpuTimerseries<Clock>::getCpuTimesInSeconds() const {
+    std::list<double>* times = new std::list<double>();
+
+    for(const BasicCpuTimer<Clock>* timer: this->getTimer()){
+        times->push_back(timer->getCpuTimeInSeconds());
+    }
+
+    return times;
+}
+
+/*
+ * Returns the CPU times in milliseconds.
+ */
+template<class Clock>
+std::list<double>*
+BasicCpuTimerseries<Clock>::getCpuTimesInMilliSeconds() const {
+    std::list<double>* times = new std::list<double>();
+
+    for(const BasicCpuTimer<Clock>* timer: this->getTimer()){
+        times->push_back(timer->getCpuTimeInMilliSeconds());
+    }
+
+    return times;
+}
+
+/*
+ * Returns the CPU times in microseconds.
+ */
+template<class Clock>
+std::list<double>*
+BasicCpuTimerseries<Clock>::getCpuTimesInMicroSeconds() const {
+    std::list<double>* times = new std::list<double>();
+
+    for(const BasicCpuTimer<Clock>* timer: this->getTimer()){
+        times->push_back(timer->getCpuTimeInMicroSeconds());
+    }
+
+    return times;
+}
+
+/*
+ * Returns the CPU times in nanoseconds.
+ */
+template<class Clock>
+std::list<double>*
+BasicCpuTimerseries<Clock>::getCpuTimesInNanoSeconds() const {
+    std::list<double>* times = new std::list<double>();
+
+    for(const BasicCpuTimer<Clock>* timer: this->getTimer()){
+        times->push_back(timer->getCpuTimeInNanoSeconds());
+    }
+
+    return times;
+}
+
+/*
+ * Returns the ratio of CPU time to wall-clock time of each CpuTimer.
+ */
+template<class Clock>
+std::list<double>* BasicCpuTimerseries<Clock>::getCpuUtilisations() const {
+    std::list<double>* utilisations = new std::list<double>();
+
+    for(const BasicCpuTimer<Clock>* timer: this->getTimer()){
+        utilisations->push_back(timer->getCpuUtilisation());
+    }
+
+    return utilisations;
+}
+
+template class BasicCpuTimerseries<RealtimeClock>;
+template class BasicCpuTimerseries<MonotonicClock>;
+template class BasicCpuTimerseries<MonotonicRawClock>;
+template class BasicCpuTimerseries<BoottimeClock>;
+template class BasicCpuTimerseries<TscClock>;
@@ -0,0 +1,145 @@
+/*
+ * File:   CpuTimerseries.h
+ * Author: Nils Döring
+ *
+ * Created on October 17, 2026, 11:40 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef CPUTIMERSERIES_H
+#define	CPUTIMERSERIES_H
+
+#include <list>
+#include "CpuTimer.h"
+#include "Timerseries.h"
+#include "Timestamp.h"
+
+/**
+ * \brief This class stores series of CpuTimer.
+ *
+ * In addition to the methods of Timerseries, which return the wall-clock
+ * durations, this class returns the CPU times and the CPU utilisation of each
+ * CpuTimer. All returned lists can be passed to Statistic, e.g. to find out
+ * whether the outliers of a series were spent computing or waiting.
+ *
+ * \attention This class is \b NOT reentrant and \b NOT thread-safe.
+ * \tparam Clock One of the wall-clock policies defined in Clock.h.
+ */
+template<class Clock>
+class BasicCpuTimerseries :
+    public BasicTimerseries<Clock, BasicCpuTimer<Clock> > {
+public:
+    /**
+     * \brief Default constructor.
+     *
+     * Creates a new CpuTimerseries with an empty container for CpuTimer.
+     */
+    BasicCpuTimerseries();
+
+    /**
+     * \brief Copy constructor.
+     *
+     * \attention All CpuTimer are copied.
+     * @param orig
+     */
+    BasicCpuTimerseries(const BasicCpuTimerseries& orig);
+
+    /**
+     * \brief Move constructor.
+     *
+     * Takes over all CpuTimer of the original series without copying them.
+     * @param orig
+     */
+    BasicCpuTimerseries(BasicCpuTimerseries&& orig);
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \attention All CpuTimer of rhs are copied.
+     * @param rhs
+     */
+    BasicCpuTimerseries& operator=(const BasicCpuTimerseries& rhs);
+
+    /**
+     * \brief Move assignment operator.
+     *
+     * Takes over all CpuTimer of rhs without copying them.
+     * @param rhs
+     */
+    BasicCpuTimerseries& operator=(BasicCpuTimerseries&& rhs);
+
+    /**
+     * \brief Standard destructor.
+     *
+     * All contained CpuTimer are destroyed.
+     */
+    virtual ~BasicCpuTimerseries();
+
+    /**
+     * \brief Get the Timestamps with the CPU time of all CpuTimer.
+     */
+    std::list<Timestamp>* getCpuTimes() const;
+
+    /**
+     * \brief Returns the CPU times of all CpuTimer in seconds.
+     */
+    std::list<double>* getCpuTimesInSeconds() const;
+
+    /**
+     * \brief Returns the CPU times of all CpuTimer in milliseconds.
+     */
+    std::list<double>* getCpuTimesInMilliSeconds() const;
+
+    /**
+     * \brief Returns the CPU times of all CpuTimer in microseconds.
+     */
+    std::list<double>* getCpuTimesInMicroSeconds() const;
+
+    /**
+     * \brief Returns the CPU times of all CpuTimer in nanoseconds.
+     */
+    std::list<double>* getCpuTimesInNanoSeconds() const;
+
+    /**
+     * \brief Returns the CPU utilisation of all CpuTimer.
+     *
+     * See CpuTimer::getCpuUtilisation().
+     */
+    std::list<double>* getCpuUtilisations() const;
+};
+
+/**
+ * \brief The default CpuTimerseries, holding CpuTimer measuring the wall-clock
+ * time with the monotonic clock.
+ */
+typedef BasicCpuTimerseries<MonotonicClock> CpuTimerseries;
+
+#endif	/* CPUTIMERSERIES_H */
@@ -0,0 +1,182 @@
+/*
+ * File:   FastTimer.h
+ * Author: Nils Döring
+ *
+ * Created on October 16, 2026, 2:05 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FASTTIMER_H
+#define	FASTTIMER_H
+
+#include <cstdint>
+#include <type_traits>
+#include "Timestamp.h"
+#include "Clock.h"
+#include "Timer.h"
+#include "Calibration.h"
+
+/**
+ * \brief This class implements a minimal start/stop timer for hot paths.
+ *
+ * A FastTimer holds nothing but two readings of its clock. It is defined in
+ * the header, has no virtual methods and is trivially copyable, so the
+ * compiler can inline start() and stop() down to the clock read. The clocks
+ * and the bias correction of Calibration are defined in their headers as well,
+ * so a FastTimer can be used without linking libhrtimerpp. Only toTimer()
+ * creates a Timer, which needs the library. Unlike Timer it does not track
+ * whether it is running: start() and stop() simply take a reading, and the
+ * duration is only meaningful after both have been called.
+ *
+ * Use toTimer() to hand a measurement to a Timerseries or anything else
+ * working with Timer. It copies the two readings.
+ *
+ * \attention This class is \b NOT reentrant and \b NOT thread-safe.
+ * \tparam Clock One of the clock policies defined in Clock.h.
+ */
+template<class Clock>
+class BasicFastTimer {
+public:
+    /**
+     * \brief Default constructor.
+     *
+     * Creates a FastTimer whose clock readings are set to zero.
+     */
+    constexpr BasicFastTimer() :
+        mStartTime(0),
+        mStopTime(0) {
+    }
+
+    /**
+     * \brief Takes the start reading.
+     */
+    void start() {
+        this->mStartTime = Clock::read();
+    }
+
+    /**
+     * \brief Takes the stop reading.
+     */
+    void stop() {
+        this->mStopTime = Clock::read();
+    }
+
+    /**
+     * \brief Sets both readings to zero.
+     */
+    void reset() {
+        this->mStartTime = 0;
+        this->mStopTime = 0;
+    }
+
+    /**
+     * \brief Returns the start reading in the raw unit of the clock.
+     */
+    constexpr std::int64_t getStartTime() const {
+        return this->mStartTime;
+    }
+
+    /**
+     * \brief Returns the stop reading in the raw unit of the clock.
+     */
+    constexpr std::int64_t getStopTime() const {
+        return this->mStopTime;
+    }
+
+    /**
+     * \brief Returns the duration in the raw unit of the clock.
+     */
+    constexpr std::int64_t getTicks() const {
+        return this->mStopTime - this->mStartTime;
+    }
+
+    /**
+     * \brief Returns the duration between the start and the stop reading.
+     *
+     * If the bias subtraction of the Calibration is enabled, the overhead of
+     * reading the clock is subtracted.
+     */
+    Timestamp getTime() const {
+        std::int64_t ticks = Calibration<Clock>::correct(this->getTicks());
+
+        return Clock::toTimestamp(ticks);
+    }
+
+    /**
+     * \brief Returns the duration in seconds.
+     */
+    double getTimeInSeconds() const {
+        return this->getTime().getTime();
+    }
+
+    /**
+     * \brief Returns the duration in milliseconds.
+     */
+    double getTimeInMilliSeconds() const {
+        return this->getTime().getTotalNanoSeconds() / 1000000.0;
+    }
+
+    /**
+     * \brief Returns the duration in microseconds.
+     */
+    double getTimeInMicroSeconds() const {
+        return this->getTime().getTotalNanoSeconds() / 1000.0;
+    }
+
+    /**
+     * \brief Returns the duration in nanoseconds.
+     */
+    double getTimeInNanoSeconds() const {
+        return this->getTime().getTotalNanoSeconds();
+    }
+
+    /**
+     * \brief Returns a stopped Timer with the same readings.
+     */
+    BasicTimer<Clock> toTimer() const {
+        return BasicTimer<Clock>(this->mStartTime, this->mStopTime);
+    }
+
+private:
+    std::int64_t mStartTime, mStopTime;
+};
+
+/**
+ * \brief The default FastTimer, measuring with the monotonic clock.
+ */
+typedef BasicFastTimer<MonotonicClock> FastTimer;
+
+static_assert(sizeof(FastTimer) == 16, "FastTimer has to hold two readings");
+#if __cplusplus >= 201402L
+static_assert(std::is_trivially_copyable<FastTimer>::value,
+    "FastTimer has to be trivially copyable");
+#endif /*__cplusplus >= 201402L*/
+
+#endif	/* FASTTIMER_H */
@@ -0,0 +1,448 @@
+/*
+ * File:   Histogram.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 22, 2026, 11:20 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "Histogram.h"
+
+#include <limits>
+
+const std::int64_t Histogram::DEFAULT_HIGHEST_VALUE;
+const int Histogram::DEFAULT_SIGNIFICANT_DIGITS;
+
+/*
+ * Allocates all buckets for the given range and precision.
+ */
+Histogram::Histogram(std::int64_t highestValue, int significantDigits) :
+    mCounts(),
+    mTotalCount(0),
+    mMin(std::numeric_limits<std::int64_t>::max()),
+    mMax(0) {
+    this->allocate(highestValue, significantDigits);
+}
+
+/*
+ * Allocates the same buckets as orig and copies the counts.
+ */
+Histogram::Histogram(const Histogram& orig) :
+    mCounts(),
+    mTotalCount(0),
+    mMin(std::numeric_limits<std::int64_t>::max()),
+    mMax(0) {
+    this->allocate(orig.mHighestValue, orig.mSignificantDigits);
+
+    *this += orig;
+}
+
+/*
+ * Allocates new buckets only if the layout differs.
+ */
+Histogram& Histogram::operator=(const Histogram& rhs) {
+    if(this == &rhs) {
+        return *this;
+    }
+
+    if(this->mSignificantDigits != rhs.mSignificantDigits
+            or this->mHighestValue != rhs.mHighestValue) {
+        this->allocate(rhs.mHighestValue, rhs.mSignificantDigits);
+    }
+
+    this->clear();
+    *this += rhs;
+
+    return *this;
+}
+
+/*
+ * The counts free themselves.
+ */
+Histogram::~Histogram() {
+}
+
+/*
+ * The layout of HdrHistogram: values below 2 * 10^digits, rounded up to a
+ * power of two, are counted exactly. Every further power of two is divided
+ * into half as many sub buckets, since its lower half is covered already.
+ */
+void Histogram::allocate(std::int64_t highestValue, int significantDigits) {
+    if(significantDigits < 1) {
+        significantDigits = 1;
+    } else if(significantDigits > 5) {
+        significantDigits = 5;
+    }
+
+    if(highestValue < 2) {
+        highestValue = 2;
+    }
+
+    std::int64_t largestSingleUnitValue = 2;
+    int subBucketCountMagnitude = 0;
+
+    for(int i = 0; i < significantDigits; ++i) {
+        largestSingleUnitValue *= 10;
+    }
+
+    while((std::int64_t(1) << subBucketCountMagnitude)
+            < largestSingleUnitValue) {
+        ++subBucketCountMagnitude;
+    }
+
+    this->mHighestValue = highestValue;
+    this->mSignificantDigits = significantDigits;
+    this->mSubBucketHalfCountMagnitude = subBucketCountMagnitude - 1;
+    this->mSubBucketHalfCount =
+        std::int64_t(1) << this->mSubBucketHalfCountMagnitude;
+    this->mSubBucketMask = (std::int64_t(1) << subBucketCountMagnitude) - 1;
+
+    /* the number of powers of two up to the highest value */
+    std::int64_t smallestUntrackableValue = this->mSubBucketMask + 1;
+    std::size_t powers = 1;
+
+    while(smallestUntrackableValue <= highestValue) {
+        if(smallestUntrackableValue
+                > std::numeric_limits<std::int64_t>::max() / 2) {
+            ++powers;
+            break;
+        }
+
+        smallestUntrackableValue <<= 1;
+        ++powers;
+    }
+
+    this->mBucketCount = (powers + 1) * this->mSubBucketHalfCount;
+    this->mCounts.reset(new std::atomic<std::uint64_t>[this->mBucketCount]);
+    this->clear();
+}
+
+/*
+ * The power of two is found by counting the leading zeros, the sub bucket by
+ * shifting the value into the range of the sub buckets.
+ */
+std::size_t Histogram::getIndex(std::int64_t value) const {
+    int power = 64 - __builtin_clzll(value | this->mSubBucketMask)
+        - (this->mSubBucketHalfCountMagnitude + 1);
+    std::int64_t subBucket = value >> power;
+
+    return (static_cast<std::int64_t>(power + 1)
+        << this->mSubBucketHalfCountMagnitude)
+        + (subBucket - this->mSubBucketHalfCount);
+}
+
+/*
+ * The inverse of getIndex().
+ */
+std::int64_t Histogram::getLowestValueAt(std::size_t index) const {
+    int power = static_cast<int>(
+        index >> this->mSubBucketHalfCountMagnitude) - 1;
+    std::int64_t subBucket = (index & (this->mSubBucketHalfCount - 1))
+        + this->mSubBucketHalfCount;
+
+    if(power < 0) {
+        subBucket -= this->mSubBucketHalfCount;
+        power = 0;
+    }
+
+    return subBucket << power;
+}
+
+/*
+ * A bucket of the power p holds 2^p values.
+ */
+std::int64_t Histogram::getHighestValueAt(std::size_t index) const {
+    int power = static_cast<int>(
+        index >> this->mSubBucketHalfCountMagnitude) - 1;
+
+    if(power < 0) {
+        power = 0;
+    }
+
+    return this->getLowestValueAt(index)
+        + ((std::int64_t(1) << power) - 1);
+}
+
+/*
+ * The value representing all values of a bucket.
+ */
+std::int64_t Histogram::getMiddleValueAt(std::size_t index) const {
+    std::int64_t lowest = this->getLowestValueAt(index);
+
+    return lowest + (this->getHighestValueAt(index) - lowest + 1) / 2;
+}
+
+/*
+ * Only a new extreme value has to be swapped in.
+ */
+void Histogram::updateMinMax(std::int64_t min, std::int64_t max) {
+    std::int64_t current = this->mMin.load(std::memory_order_relaxed);
+
+    while(min < current and !this->mMin.compare_exchange_weak(current, min,
+            std::memory_order_relaxed)) {
+    }
+
+    current = this->mMax.load(std::memory_order_relaxed);
+
+    while(max > current and !this->mMax.compare_exchange_weak(current, max,
+            std::memory_order_relaxed)) {
+    }
+}
+
+/*
+ * Counts a single value.
+ */
+void Histogram::record(std::int64_t value) {
+    this->record(value, 1);
+}
+
+/*
+ * Out of range values are clamped. The counters are independent, so relaxed
+ * increments suffice.
+ */
+void Histogram::record(std::int64_t value, std::uint64_t count) {
+    if(value < 0) {
+        value = 0;
+    } else if(value > this->mHighestValue) {
+        value = this->mHighestValue;
+    }
+
+    this->mCounts[this->getIndex(value)].fetch_add(count,
+        std::memory_order_relaxed);
+    this->mTotalCount.fetch_add(count, std::memory_order_relaxed);
+    this->updateMinMax(value, value);
+}
+
+/*
+ * With the same layout, the buckets correspond to each other. Otherwise the
+ * middle value of each bucket of rhs is counted. The minimum and maximum of
+ * rhs are exact either way.
+ */
+Histogram& Histogram::operator+=(const Histogram& rhs) {
+    bool sameLayout = this->mSignificantDigits == rhs.mSignificantDigits
+        and this->mBucketCount == rhs.mBucketCount;
+    std::uint64_t total = 0;
+
+    for(std::size_t i = 0; i < rhs.mBucketCount; ++i) {
+        std::uint64_t count = rhs.mCounts[i].load(std::memory_order_relaxed);
+
+        if(count == 0) {
+            continue;
+        }
+
+        std::size_t index = i;
+
+        if(!sameLayout) {
+            std::int64_t value = rhs.getMiddleValueAt(i);
+            index = this->getIndex(value > this->mHighestValue
+                ? this->mHighestValue : value);
+        }
+
+        this->mCounts[index].fetch_add(count, std::memory_order_relaxed);
+        total += count;
+    }
+
+    if(total > 0) {
+        this->mTotalCount.fetch_add(total, std::memory_order_relaxed);
+        this->updateMinMax(rhs.mMin.load(std::memory_order_relaxed),
+            rhs.mMax.load(std::memory_order_relaxed));
+    }
+
+    return *this;
+}
+
+/*
+ * Zeroes all counters.
+ */
+void Histogram::clear() {
+    for(std::size_t i = 0; i < this->mBucketCount; ++i) {
+        this->mCounts[i].store(0, std::memory_order_relaxed);
+    }
+
+    this->mTotalCount.store(0, std::memory_order_relaxed);
+    this->mMin.store(std::numeric_limits<std::int64_t>::max(),
+        std::memory_order_relaxed);
+    this->mMax.store(0, std::memory_order_relaxed);
+}
+
+/*
+ * This returns the number of values.
+ */
+std::uint64_t Histogram::getNumberOfElements() const {
+    return this->mTotalCount.load(std::memory_order_relaxed);
+}
+
+/*
+ * The minimum is exact.
+ */
+double Histogram::getMin() const {
+    if(this->getNumberOfElements() == 0) {
+        return 0;
+    }
+
+    return this->mMin.load(std::memory_order_relaxed);
+}
+
+/*
+ * The maximum is exact.
+ */
+double Histogram::getMax() const {
+    if(this->getNumberOfElements() == 0) {
+        return 0;
+    }
+
+    return this->mMax.load(std::memory_order_relaxed);
+}
+
+/*
+ * Every value is represented by the middle value of its bucket.
+ */
+double Histogram::getMean() const {
+    double sum = 0;
+    std::uint64_t total = 0;
+
+    for(std::size_t i = 0; i < this->mBucketCount; ++i) {
+        std::uint64_t count = this->mCounts[i].load(std::memory_order_relaxed);
+
+        if(count > 0) {
+            sum += count * static_cast<double>(this->getMiddleValueAt(i));
+            total += count;
+        }
+    }
+
+    return total == 0 ? 0 : sum / total;
+}
+
+/*
+ * Sums the squared differences of the middle values from the mean.
+ */
+double Histogram::getVariance() const {
+    double mean = this->getMean();
+    double sum = 0;
+    std::uint64_t total = 0;
+
+    for(std::size_t i = 0; i < this->mBucketCount; ++i) {
+        std::uint64_t count = this->mCounts[i].load(std::memory_order_relaxed);
+
+        if(count > 0) {
+            double difference = this->getMiddleValueAt(i) - mean;
+
+            sum += count * difference * difference;
+            total += count;
+        }
+    }
+
+    return total <= 1 ? 0 : sum / (total - 1);
+}
+
+/*
+ * The standard deviation is the root of the variance.
+ */
+double Histogram::getStddev() const {
+    return std::sqrt(this->getVariance());
+}
+
+/*
+ * This returns the median value.
+ */
+double Histogram::getMedian() const {
+    return this->getPercentile(50);
+}
+
+/*
+ * This returns the value of the first quartile.
+ */
+double Histogram::getFirstQuartile() const {
+    return this->getPercentile(25);
+}
+
+/*
+ * This returns the value of the third quartile.
+ */
+double Histogram::getThirdQuartile() const {
+    return this->getPercentile(75);
+}
+
+/*
+ * Sums the counts up to the rank of the percentile. The highest value of that
+ * bucket is limited by the exact extremes.
+ */
+double Histogram::getPercentile(double percentile) const {
+    std::uint64_t total = this->getNumberOfElements();
+
+    if(total == 0 or percentile < 0 or percentile > 100) {
+        return 0;
+    }
+
+    std::uint64_t rank = static_cast<std::uint64_t>(
+        std::ceil(percentile / 100.0 * total));
+    std::uint64_t count = 0;
+    double max = this->getMax();
+    double min = this->getMin();
+
+    if(rank < 1) {
+        rank = 1;
+    }
+
+    for(std::size_t i = 0; i < this->mBucketCount; ++i) {
+        count += this->mCounts[i].load(std::memory_order_relaxed);
+
+        if(count >= rank) {
+            double value = this->getHighestValueAt(i);
+
+            return value > max ? max : (value < min ? min : value);
+        }
+    }
+
+    return max;
+}
+
+/*
+ * Returns the highest value to distinguish.
+ */
+std::int64_t Histogram::getHighestValue() const {
+    return this->mHighestValue;
+}
+
+/*
+ * Returns the precision of the buckets.
+ */
+int Histogram::getSignificantDigits() const {
+    return this->mSignificantDigits;
+}
+
+/*
+ * Returns the number of counters.
+ */
+std::size_t Histogram::getBucketCount() const {
+    return this->mBucketCount;
+}
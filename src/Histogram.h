@@ -0,0 +1,297 @@
+/*
+ * File:   Histogram.h
+ * Author: Nils Döring
+ *
+ * Created on October 22, 2026, 11:20 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef HISTOGRAM_H
+#define	HISTOGRAM_H
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "Timestamp.h"
+#include "Timer.h"
+#include "Timerseries.h"
+#include "ContiguousTimerseries.h"
+#include "TimeView.h"
+
+/**
+ * \brief This class counts values in a histogram with a high dynamic range.
+ *
+ * The values are integers, e.g. durations in nanoseconds. The buckets are
+ * log-linear: each power of two is divided into the same number of linear sub
+ * buckets, so every value is counted with the same relative precision of the
+ * given number of significant decimal digits. Recording a value increments a
+ * single counter. The memory is allocated by the constructor and does not
+ * grow: two significant digits and values up to an hour in nanoseconds take
+ * less than 40 KB.
+ *
+ * Any number of threads may record at the same time without a lock, and
+ * histograms of different threads or processes can be merged. The getters
+ * provide the same names as Statistic:
+ * \code
+ * Histogram histogram;
+ * ...
+ * histogram.record(timer);  // in nanoseconds
+ * ...
+ * histogram.getPercentile(99.9);
+ * \endcode
+ *
+ * The results are exact to the precision of the buckets, except for the
+ * minimum and the maximum, which are exact. This is the design of the
+ * HdrHistogram of Gil Tene.
+ *
+ * \attention Recording and merging are thread-safe. The getters see the
+ * values recorded before, but not necessarily all values recorded at the same
+ * time. clear() must not run while other threads record.
+ */
+class Histogram {
+public:
+    /**
+     * \brief The default highest value, an hour in nanoseconds.
+     */
+    static const std::int64_t DEFAULT_HIGHEST_VALUE = 3600000000000LL;
+
+    /**
+     * \brief The default number of significant decimal digits.
+     */
+    static const int DEFAULT_SIGNIFICANT_DIGITS = 2;
+
+    /**
+     * \brief Creates an empty histogram.
+     *
+     * Values above highestValue are counted as highestValue, negative values
+     * as 0.
+     * @param highestValue The highest value to distinguish, at least 2
+     * @param significantDigits The precision of the buckets, from 1 to 5
+     */
+    Histogram(std::int64_t highestValue = DEFAULT_HIGHEST_VALUE,
+        int significantDigits = DEFAULT_SIGNIFICANT_DIGITS);
+
+    /**
+     * \brief Creates a histogram of the durations of a Timerseries.
+     *
+     * The durations are recorded in nanoseconds.
+     * @param series
+     * @param highestValue See Histogram(std::int64_t, int)
+     * @param significantDigits See Histogram(std::int64_t, int)
+     */
+    template<class Clock, class TimerType, class Allocator>
+    explicit Histogram(
+            const BasicTimerseries<Clock, TimerType, Allocator>& series,
+            std::int64_t highestValue = DEFAULT_HIGHEST_VALUE,
+            int significantDigits = DEFAULT_SIGNIFICANT_DIGITS) :
+            Histogram(highestValue, significantDigits) {
+        this->record(series);
+    }
+
+    /**
+     * \brief Copy constructor.
+     *
+     * Copies the counts of orig.
+     * @param orig
+     */
+    Histogram(const Histogram& orig);
+
+    /**
+     * \brief Assignment operator.
+     *
+     * Takes over the layout and the counts of rhs.
+     * @param rhs
+     */
+    Histogram& operator=(const Histogram& rhs);
+
+    /**
+     * \brief Standard destructor.
+     */
+    virtual ~Histogram();
+
+    /**
+     * \brief Counts the value once.
+     * @param value
+     */
+    void record(std::int64_t value);
+
+    /**
+     * \brief Counts the value count times.
+     * @param value
+     * @param count
+     */
+    void record(std::int64_t value, std::uint64_t count);
+
+    /**
+     * \brief Counts the duration of the Timer in nanoseconds.
+     * @param timer
+     */
+    template<class Clock>
+    void record(const BasicTimer<Clock>& timer) {
+        this->record(timer.getTime().getTotalNanoSeconds());
+    }
+
+    /**
+     * \brief Counts the durations of all Timer in nanoseconds.
+     * @param series
+     */
+    template<class Clock, class TimerType, class Allocator>
+    void record(const BasicTimerseries<Clock, TimerType, Allocator>& series) {
+        for(const Timestamp& time: series.viewTimes()) {
+            this->record(time.getTotalNanoSeconds());
+        }
+    }
+
+    /**
+     * \brief Counts the durations of all measurements in nanoseconds.
+     * @param series
+     */
+    template<class Clock>
+    void record(const BasicContiguousTimerseries<Clock>& series) {
+        for(double time: series.viewTimesInNanoSeconds()) {
+            this->record(std::llround(time));
+        }
+    }
+
+    /**
+     * \brief Adds the counts of rhs to this histogram.
+     *
+     * If both have the same layout, the counts are added bucket by bucket.
+     * Otherwise every bucket of rhs is recorded by a value within it.
+     * @param rhs
+     */
+    Histogram& operator+=(const Histogram& rhs);
+
+    /**
+     * \brief Removes all values.
+     */
+    void clear();
+
+    /**
+     * \brief Returns the number of recorded values.
+     */
+    std::uint64_t getNumberOfElements() const;
+
+    /**
+     * \brief Returns the smallest recorded value.
+     */
+    double getMin() const;
+
+    /**
+     * \brief Returns the largest recorded value.
+     */
+    double getMax() const;
+
+    /**
+     * \brief Returns the mean of the recorded values.
+     */
+    double getMean() const;
+
+    /**
+     * \brief Returns the variance of the recorded values.
+     *
+     * Like Statistic, this is the sample variance, divided by n - 1.
+     */
+    double getVariance() const;
+
+    /**
+     * \brief Returns the standard deviation of the recorded values.
+     */
+    double getStddev() const;
+
+    /**
+     * \brief Returns the median of the recorded values.
+     */
+    double getMedian() const;
+
+    /**
+     * \brief Returns the first quartile of the recorded values.
+     */
+    double getFirstQuartile() const;
+
+    /**
+     * \brief Returns the third quartile of the recorded values.
+     */
+    double getThirdQuartile() const;
+
+    /**
+     * \brief Returns an arbitrary percentile of the recorded values.
+     *
+     * This is the highest value of the bucket holding the value of rank
+     * ceil(percentile / 100 * n), but at most the maximum. Returns 0, if
+     * there are no values or if percentile is not within [0, 100].
+     * @param percentile E.g. 99.9
+     */
+    double getPercentile(double percentile) const;
+
+    /**
+     * \brief Returns the highest value to distinguish.
+     */
+    std::int64_t getHighestValue() const;
+
+    /**
+     * \brief Returns the number of significant decimal digits.
+     */
+    int getSignificantDigits() const;
+
+    /**
+     * \brief Returns the number of buckets.
+     */
+    std::size_t getBucketCount() const;
+
+private:
+    void allocate(std::int64_t highestValue, int significantDigits);
+    std::size_t getIndex(std::int64_t value) const;
+    std::int64_t getLowestValueAt(std::size_t index) const;
+    std::int64_t getHighestValueAt(std::size_t index) const;
+    std::int64_t getMiddleValueAt(std::size_t index) const;
+    void updateMinMax(std::int64_t min, std::int64_t max);
+
+    std::int64_t mHighestValue;
+    int mSignificantDigits;
+
+    /* each power of two is divided into mSubBucketCount sub buckets, the upper
+     * half of them is new in each power */
+    int mSubBucketHalfCountMagnitude;
+    std::int64_t mSubBucketHalfCount;
+    std::int64_t mSubBucketMask;
+
+    std::size_t mBucketCount;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> mCounts;
+    std::atomic<std::uint64_t> mTotalCount;
+    std::atomic<std::int64_t> mMin;
+    std::atomic<std::int64_t> mMax;
+};
+
+#endif	/* HISTOGRAM_H */
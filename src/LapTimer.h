@@ -0,0 +1,215 @@
+/*
+ * File:   LapTimer.h
+ * Author: Nils Döring
+ *
+ * Created on October 16, 2026, 4:45 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef LAPTIMER_H
+#define	LAPTIMER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include "Timestamp.h"
+#include "Clock.h"
+#include "Calibration.h"
+#include "Timer.h"
+
+/**
+ * \brief This class implements a Timer recording laps.
+ *
+ * Every call of lap() records the split time, i.e. the duration of the Timer
+ * up to this moment, into a buffer of fixed capacity inside the object. The
+ * duration of a lap is the difference between two consecutive split times.
+ * Since the buffer is part of the object, recording a lap never allocates.
+ * Laps recorded after the buffer is full are dropped and counted.
+ *
+ * The Timer can be paused and resumed between laps. Paused time is excluded
+ * from the split times and therefore from the laps.
+ *
+ * \attention This class is \b NOT reentrant and \b NOT thread-safe.
+ * \attention The object grows by eight bytes per lap of capacity. Allocate
+ * timers with large capacities statically or on the heap.
+ * \tparam Clock One of the clock policies defined in Clock.h.
+ * \tparam Capacity The maximal number of laps to record.
+ */
+template<class Clock, std::size_t Capacity>
+class BasicLapTimer : public BasicTimer<Clock> {
+public:
+    /**
+     * \brief Default constructor.
+     *
+     * Creates a reset Timer without any laps.
+     */
+    BasicLapTimer() :
+        BasicTimer<Clock>(),
+        mNumberOfLaps(0),
+        mDroppedLaps(0) {
+    }
+
+    /**
+     * \brief Record a lap.
+     *
+     * This stores the split time of the running Timer. If the buffer is full,
+     * the lap is dropped.
+     *
+     * \attention This method fails silently. The user has to check if the
+     * timer is running.
+     */
+    void lap() {
+        if(!this->isRunning()) {
+            return;
+        }
+
+        if(this->mNumberOfLaps < Capacity) {
+            this->mSplitTimes[this->mNumberOfLaps++] = this->getElapsedTicks();
+        } else {
+            ++this->mDroppedLaps;
+        }
+    }
+
+    /**
+     * \brief Reset the timer and remove all laps.
+     *
+     * This overrides BasicTimer::reset(), so the laps are also removed through
+     * a reference to BasicTimer.
+     */
+    virtual void reset() {
+        BasicTimer<Clock>::reset();
+
+        this->mNumberOfLaps = 0;
+        this->mDroppedLaps = 0;
+    }
+
+    /**
+     * \brief Returns the number of recorded laps.
+     */
+    std::size_t getNumberOfLaps() const {
+        return this->mNumberOfLaps;
+    }
+
+    /**
+     * \brief Returns the number of laps dropped since the buffer was full.
+     */
+    std::size_t getDroppedLaps() const {
+        return this->mDroppedLaps;
+    }
+
+    /**
+     * \brief Returns the maximal number of laps.
+     */
+    static constexpr std::size_t getCapacity() {
+        return Capacity;
+    }
+
+    /**
+     * \brief Returns the duration from the start to the given lap.
+     *
+     * If the bias subtraction of the Calibration is enabled, the overhead of
+     * reading the clock is subtracted, like for getTime().
+     *
+     * \attention There is no range check. The lap has to be smaller than
+     * getNumberOfLaps().
+     * @param lap
+     */
+    Timestamp getSplitTime(const std::size_t lap) const {
+        return Clock::toTimestamp(
+            Calibration<Clock>::correct(this->mSplitTimes[lap]));
+    }
+
+    /**
+     * \brief Returns the duration of the given lap.
+     *
+     * The first lap starts at the start of the Timer. This is the difference
+     * of the split times, so the laps add up to the last split time, with or
+     * without the bias subtraction of the Calibration.
+     *
+     * \attention There is no range check. The lap has to be smaller than
+     * getNumberOfLaps().
+     * @param lap
+     */
+    Timestamp getLapTime(const std::size_t lap) const {
+        std::int64_t ticks =
+            Calibration<Clock>::correct(this->mSplitTimes[lap]);
+
+        if(lap > 0) {
+            ticks -= Calibration<Clock>::correct(this->mSplitTimes[lap - 1]);
+        }
+
+        return Clock::toTimestamp(ticks);
+    }
+
+    /**
+     * \brief Returns the durations of all laps in seconds.
+     *
+     * The returned list has to be deleted by the caller. It can be passed to
+     * Statistic, which takes care of this.
+     */
+    std::list<double>* getLapTimesInSeconds() const {
+        std::list<double>* times = new std::list<double>();
+
+        for(std::size_t lap = 0; lap < this->mNumberOfLaps; ++lap) {
+            times->push_back(this->getLapTime(lap).getTime());
+        }
+
+        return times;
+    }
+
+    /**
+     * \brief Returns the durations of all laps in nanoseconds.
+     *
+     * The returned list has to be deleted by the caller. It can be passed to
+     * Statistic, which takes care of this.
+     */
+    std::list<double>* getLapTimesInNanoSeconds() const {
+        std::list<double>* times = new std::list<double>();
+
+        for(std::size_t lap = 0; lap < this->mNumberOfLaps; ++lap) {
+            times->push_back(this->getLapTime(lap).getTotalNanoSeconds());
+        }
+
+        return times;
+    }
+
+private:
+    std::int64_t mSplitTimes[Capacity];
+    std::size_t mNumberOfLaps;
+    std::size_t mDroppedLaps;
+};
+
+/**
+ * \brief The default LapTimer, measuring with the monotonic clock.
+ */
+template<std::size_t Capacity>
+using LapTimer = BasicLapTimer<MonotonicClock, Capacity>;
+
+#endif	/* LAPTIMER_H */
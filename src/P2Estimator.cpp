@@ -0,0 +1,330 @@
+/*
+ * File:   P2Estimator.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 23, 2026, 3:15 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#include "P2Estimator.h"
+
+#include <stdexcept>
+
+const std::size_t P2Estimator::MAX_PERCENTILES;
+const int P2Estimator::MARKERS;
+
+/*
+ * The quartiles are tracked, like Statistic calculates them.
+ */
+P2Estimator::P2Estimator() : P2Estimator({25, 50, 75}) {
+}
+
+/*
+ * The list is passed as an array.
+ */
+P2Estimator::P2Estimator(std::initializer_list<double> percentiles) :
+    P2Estimator(percentiles.begin(), percentiles.size()) {
+}
+
+/*
+ * The P² algorithm only works for percentiles strictly between 0 and 100,
+ * the extremes are the outer markers anyway.
+ */
+P2Estimator::P2Estimator(const double* percentiles, std::size_t count) :
+    mMarkers(),
+    mPercentileCount(count),
+    mNumberOfElements(0),
+    mSum(0) {
+    if(count == 0 or count > MAX_PERCENTILES) {
+        throw std::invalid_argument("P2Estimator: invalid number of "
+            "percentiles");
+    }
+
+    for(std::size_t i = 0; i < count; ++i) {
+        if(!(percentiles[i] > 0 and percentiles[i] < 100)) {
+            throw std::invalid_argument("P2Estimator: percentile not within "
+                "(0, 100)");
+        }
+
+        this->mMarkers[i].mQuantile = percentiles[i] / 100.0;
+    }
+
+    this->clear();
+}
+
+/*
+ * Nothing to free.
+ */
+P2Estimator::~P2Estimator() {
+}
+
+/*
+ * Updates the markers of all tracked percentiles.
+ */
+void P2Estimator::add(double value) {
+    ++this->mNumberOfElements;
+    this->mSum += value;
+
+    for(std::size_t i = 0; i < this->mPercentileCount; ++i) {
+        this->addTo(this->mMarkers[i], value);
+    }
+}
+
+/*
+ * The first five values are sorted into the markers. Afterwards the value
+ * moves the markers above it up by one rank. Each inner marker, that is at
+ * least one rank away from its desired position, is moved one rank towards
+ * it. Its new height is predicted by a parabola through it and its
+ * neighbours, or linearly, if the parabola leaves the neighbours.
+ */
+void P2Estimator::addTo(Markers& markers, double value) {
+    double* heights = markers.mHeights;
+    std::int64_t* positions = markers.mPositions;
+    std::uint64_t count = this->mNumberOfElements;
+
+    if(count <= static_cast<std::uint64_t>(MARKERS)) {
+        int i = static_cast<int>(count) - 1;
+
+        for(; i > 0 and heights[i - 1] > value; --i) {
+            heights[i] = heights[i - 1];
+        }
+
+        heights[i] = value;
+
+        return;
+    }
+
+    int cell;
+
+    if(value < heights[0]) {
+        heights[0] = value;
+        cell = 0;
+    } else if(value >= heights[MARKERS - 1]) {
+        heights[MARKERS - 1] = value;
+        cell = MARKERS - 2;
+    } else {
+        cell = 0;
+
+        while(value >= heights[cell + 1]) {
+            ++cell;
+        }
+    }
+
+    for(int i = cell + 1; i < MARKERS; ++i) {
+        ++positions[i];
+    }
+
+    double quantile = markers.mQuantile;
+    double increments[MARKERS] = {0, quantile / 2, quantile,
+        (1 + quantile) / 2, 1};
+
+    for(int i = 1; i < MARKERS - 1; ++i) {
+        double desired = 1 + (count - 1) * increments[i];
+        double difference = desired - positions[i];
+        std::int64_t below = positions[i - 1] - positions[i];
+        std::int64_t above = positions[i + 1] - positions[i];
+
+        if((difference >= 1 and above > 1)
+                or (difference <= -1 and below < -1)) {
+            int sign = difference > 0 ? 1 : -1;
+            double height = heights[i] + sign
+                / static_cast<double>(positions[i + 1] - positions[i - 1])
+                * ((positions[i] - positions[i - 1] + sign)
+                    * (heights[i + 1] - heights[i]) / above
+                + (positions[i + 1] - positions[i] - sign)
+                    * (heights[i] - heights[i - 1]) / -below);
+
+            if(!(heights[i - 1] < height and height < heights[i + 1])) {
+                height = heights[i] + sign * (heights[i + sign] - heights[i])
+                    / (positions[i + sign] - positions[i]);
+            }
+
+            heights[i] = height;
+            positions[i] += sign;
+        }
+    }
+}
+
+/*
+ * This is add().
+ */
+P2Estimator& P2Estimator::operator+=(double value) {
+    this->add(value);
+
+    return *this;
+}
+
+/*
+ * The markers start at the ranks 1 to 5.
+ */
+void P2Estimator::clear() {
+    for(std::size_t i = 0; i < this->mPercentileCount; ++i) {
+        for(int j = 0; j < MARKERS; ++j) {
+            this->mMarkers[i].mHeights[j] = 0;
+            this->mMarkers[i].mPositions[j] = j + 1;
+        }
+    }
+
+    this->mNumberOfElements = 0;
+    this->mSum = 0;
+}
+
+/*
+ * This returns the number of values.
+ */
+std::uint64_t P2Estimator::getNumberOfElements() const {
+    return this->mNumberOfElements;
+}
+
+/*
+ * The minimum is the first marker.
+ */
+double P2Estimator::getMin() const {
+    return this->mMarkers[0].mHeights[0];
+}
+
+/*
+ * The maximum is the last marker, or the last of the sorted values.
+ */
+double P2Estimator::getMax() const {
+    if(this->mNumberOfElements == 0) {
+        return 0;
+    }
+
+    if(this->mNumberOfElements < static_cast<std::uint64_t>(MARKERS)) {
+        return this->mMarkers[0].mHeights[this->mNumberOfElements - 1];
+    }
+
+    return this->mMarkers[0].mHeights[MARKERS - 1];
+}
+
+/*
+ * The mean is exact, apart from rounding.
+ */
+double P2Estimator::getMean() const {
+    return this->mNumberOfElements == 0 ? 0
+        : this->mSum / this->mNumberOfElements;
+}
+
+/*
+ * This returns the median value.
+ */
+double P2Estimator::getMedian() const {
+    return this->getPercentile(50);
+}
+
+/*
+ * This returns the value of the first quartile.
+ */
+double P2Estimator::getFirstQuartile() const {
+    return this->getPercentile(25);
+}
+
+/*
+ * This returns the value of the third quartile.
+ */
+double P2Estimator::getThirdQuartile() const {
+    return this->getPercentile(75);
+}
+
+/*
+ * The rank of a percentile is 1 + p * (n - 1), the desired position of the
+ * middle marker. The markers of all tracked percentiles next to that rank are
+ * interpolated.
+ */
+double P2Estimator::getPercentile(double percentile) const {
+    std::uint64_t count = this->mNumberOfElements;
+
+    if(count == 0 or percentile < 0 or percentile > 100) {
+        return 0;
+    }
+
+    double quantile = percentile / 100.0;
+    int markers = count < static_cast<std::uint64_t>(MARKERS)
+        ? static_cast<int>(count) : MARKERS;
+
+    if(count > static_cast<std::uint64_t>(MARKERS)) {
+        for(std::size_t i = 0; i < this->mPercentileCount; ++i) {
+            if(this->mMarkers[i].mQuantile == quantile) {
+                return this->mMarkers[i].mHeights[MARKERS / 2];
+            }
+        }
+    }
+
+    double rank = 1 + quantile * (count - 1);
+    double lowerPosition = 1, upperPosition = count;
+    double lower = this->getMin(), upper = this->getMax();
+
+    for(std::size_t i = 0; i < this->mPercentileCount; ++i) {
+        const Markers& current = this->mMarkers[i];
+
+        for(int j = 0; j < markers; ++j) {
+            double position = static_cast<double>(current.mPositions[j]);
+
+            if(position <= rank and position >= lowerPosition) {
+                lowerPosition = position;
+                lower = current.mHeights[j];
+            }
+
+            if(position >= rank and position <= upperPosition) {
+                upperPosition = position;
+                upper = current.mHeights[j];
+            }
+        }
+    }
+
+    if(upperPosition == lowerPosition) {
+        return lower;
+    }
+
+    return lower + (upper - lower) * (rank - lowerPosition)
+        / (upperPosition - lowerPosition);
+}
+
+/*
+ * Returns the number of tracked percentiles.
+ */
+std::size_t P2Estimator::getPercentileCount() const {
+    return this->mPercentileCount;
+}
+
+/*
+ * Returns a tracked percentile, or 0 for an invalid index.
+ */
+double P2Estimator::getTrackedPercentile(std::size_t index) const {
+    if(index >= this->mPercentileCount) {
+        return 0;
+    }
+
+    return this->mMarkers[index].mQuantile * 100;
+}
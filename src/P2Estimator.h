@@ -0,0 +1,212 @@
+/*
+ * File:   P2Estimator.h
+ * Author: Nils Döring
+ *
+ * Created on October 23, 2026, 3:15 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#ifndef P2ESTIMATOR_H
+#define	P2ESTIMATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include "Timestamp.h"
+#include "Timer.h"
+
+/**
+ * \brief This class estimates a few percentiles of a stream of values in
+ * constant memory.
+ *
+ * It implements the P² algorithm of Jain and Chlamtac. Each tracked
+ * percentile is estimated by five markers: the minimum, the maximum, the
+ * percentile and two values in between. Every value moves the markers by at
+ * most one rank and adjusts their heights with a parabolic prediction, so an
+ * update takes constant time and no value is stored. The object does not
+ * allocate and is smaller than 400 bytes:
+ * \code
+ * P2Estimator estimator({50, 90, 99});
+ * ...
+ * estimator.add(timer);  // in nanoseconds
+ * ...
+ * estimator.getPercentile(99);
+ * \endcode
+ *
+ * The getters provide the same names as Statistic. The quartiles are tracked
+ * by default. Percentiles that are not tracked are interpolated between the
+ * markers, which is far off for a long tail between the last inner marker and
+ * the maximum. So every percentile of interest should be tracked.
+ *
+ * \attention This class is not thread-safe.
+ */
+class P2Estimator {
+public:
+    /**
+     * \brief The maximum number of tracked percentiles.
+     */
+    static const std::size_t MAX_PERCENTILES = 4;
+
+    /**
+     * \brief Creates an estimator of the first quartile, the median and the
+     * third quartile.
+     */
+    P2Estimator();
+
+    /**
+     * \brief Creates an estimator of the given percentiles.
+     *
+     * Throws std::invalid_argument, if there are no or more than
+     * MAX_PERCENTILES percentiles, or if one is not within (0, 100).
+     * @param percentiles E.g. {50, 90, 99}
+     */
+    P2Estimator(std::initializer_list<double> percentiles);
+
+    /**
+     * \brief Creates an estimator of the given percentiles.
+     *
+     * See P2Estimator(std::initializer_list<double>).
+     * @param percentiles
+     * @param count The number of percentiles
+     */
+    P2Estimator(const double* percentiles, std::size_t count);
+
+    /**
+     * \brief Standard destructor.
+     */
+    virtual ~P2Estimator();
+
+    /**
+     * \brief Adds a value and updates the markers.
+     * @param value
+     */
+    void add(double value);
+
+    /**
+     * \brief Adds the duration of the Timer in nanoseconds.
+     * @param timer
+     */
+    template<class Clock>
+    void add(const BasicTimer<Clock>& timer) {
+        this->add(static_cast<double>(timer.getTime().getTotalNanoSeconds()));
+    }
+
+    /**
+     * \brief Same as add(double).
+     * @param value
+     */
+    P2Estimator& operator+=(double value);
+
+    /**
+     * \brief Removes all values, the tracked percentiles are kept.
+     */
+    void clear();
+
+    /**
+     * \brief Returns the number of values.
+     */
+    std::uint64_t getNumberOfElements() const;
+
+    /**
+     * \brief Returns the smallest value.
+     */
+    double getMin() const;
+
+    /**
+     * \brief Returns the largest value.
+     */
+    double getMax() const;
+
+    /**
+     * \brief Returns the mean of the values.
+     */
+    double getMean() const;
+
+    /**
+     * \brief Returns the estimated median of the values.
+     */
+    double getMedian() const;
+
+    /**
+     * \brief Returns the estimated first quartile of the values.
+     */
+    double getFirstQuartile() const;
+
+    /**
+     * \brief Returns the estimated third quartile of the values.
+     */
+    double getThirdQuartile() const;
+
+    /**
+     * \brief Returns an estimated arbitrary percentile of the values.
+     *
+     * A tracked percentile returns its marker, any other one is interpolated
+     * linearly between the markers next to its rank. Up to five values, this
+     * is exact like Statistic::LINEAR. Returns 0, if there are no values or if
+     * percentile is not within [0, 100].
+     * @param percentile E.g. 99.9
+     */
+    double getPercentile(double percentile) const;
+
+    /**
+     * \brief Returns the number of tracked percentiles.
+     */
+    std::size_t getPercentileCount() const;
+
+    /**
+     * \brief Returns a tracked percentile.
+     * @param index Less than getPercentileCount()
+     */
+    double getTrackedPercentile(std::size_t index) const;
+
+private:
+    static const int MARKERS = 5;
+
+    /* the heights are the estimated values, the positions their ranks
+     * starting at 1. Until there are five values, they are the sorted values
+     * at the ranks 1 to 5 */
+    struct Markers {
+        double mQuantile;
+        double mHeights[MARKERS];
+        std::int64_t mPositions[MARKERS];
+    };
+
+    void addTo(Markers& markers, double value);
+
+    Markers mMarkers[MAX_PERCENTILES];
+    std::size_t mPercentileCount;
+    std::uint64_t mNumberOfElements;
+    double mSum;
+};
+
+#endif	/* P2ESTIMATOR_H */
@@ -0,0 +1,392 @@
+/*
+ * File:   PerfCounters.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 17, 2026, 2:15 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "PerfCounters.h"
+
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+/* the perf_event_open() type and config of each PerfCounters::Event */
+struct EventConfig {
+    std::uint32_t type;
+    std::uint64_t config;
+    const char* name;
+};
+
+const EventConfig EVENT_CONFIGS[PerfCounters::NUMBER_OF_EVENTS] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, "cycles"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, "instructions"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, "cache-misses"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, "branch-misses"},
+    {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES, "context-switches"},
+    {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS, "page-faults"}
+};
+
+/* glibc provides no wrapper for this system call */
+int perfEventOpen(perf_event_attr* attr, int groupFd) {
+    unsigned long flags = 0;
+#ifdef PERF_FLAG_FD_CLOEXEC
+    flags |= PERF_FLAG_FD_CLOEXEC;
+#endif
+    return static_cast<int>(syscall(SYS_perf_event_open, attr, 0, -1, groupFd,
+        flags));
+}
+
+}
+
+/*
+ * Create an object without any counted event.
+ */
+PerfCounters::PerfCounters() {
+    this->reset();
+}
+
+/*
+ * Copy all values and flags.
+ */
+PerfCounters::PerfCounters(const PerfCounters& orig) {
+    *this = orig;
+}
+
+/*
+ * Copy all values and flags.
+ */
+PerfCounters& PerfCounters::operator=(const PerfCounters& rhs) {
+    for(int i = 0; i < NUMBER_OF_EVENTS; ++i) {
+        this->mValues[i] = rhs.mValues[i];
+        this->mIsCounted[i] = rhs.mIsCounted[i];
+    }
+
+    return *this;
+}
+
+/*
+ * Add the values of all events. Not counted events have a value of zero.
+ */
+PerfCounters& PerfCounters::operator+=(const PerfCounters& rhs) {
+    for(int i = 0; i < NUMBER_OF_EVENTS; ++i) {
+        this->mValues[i] += rhs.mValues[i];
+        this->mIsCounted[i] = this->mIsCounted[i] || rhs.mIsCounted[i];
+    }
+
+    return *this;
+}
+
+/*
+ * The counters only increase, so this is the number of events in between both
+ * readings.
+ */
+const PerfCounters PerfCounters::operator-(const PerfCounters& rhs) const {
+    PerfCounters difference;
+
+    for(int i = 0; i < NUMBER_OF_EVENTS; ++i) {
+        if(this->mIsCounted[i] && rhs.mIsCounted[i]) {
+            difference.set(static_cast<Event>(i),
+                this->mValues[i] - rhs.mValues[i]);
+        }
+    }
+
+    return difference;
+}
+
+/*
+ * Compare the flags and the values of the counted events.
+ */
+bool PerfCounters::operator==(const PerfCounters& rhs) const {
+    for(int i = 0; i < NUMBER_OF_EVENTS; ++i) {
+        if(this->mIsCounted[i] != rhs.mIsCounted[i]
+                || this->mValues[i] != rhs.mValues[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * See operator==.
+ */
+bool PerfCounters::operator!=(const PerfCounters& rhs) const {
+    return !(*this == rhs);
+}
+
+/*
+ * Set all values to zero and all events to not counted.
+ */
+void PerfCounters::reset() {
+    for(int i = 0; i < NUMBER_OF_EVENTS; ++i) {
+        this->mValues[i] = 0;
+        this->mIsCounted[i] = false;
+    }
+}
+
+/*
+ * Returns the value of the event.
+ */
+std::uint64_t PerfCounters::get(Event event) const {
+    return this->mValues[event];
+}
+
+/*
+ * Set the value of the event and mark it as counted.
+ */
+void PerfCounters::set(Event event, std::uint64_t value) {
+    this->mValues[event] = value;
+    this->mIsCounted[event] = true;
+}
+
+/*
+ * Returns if the event is counted.
+ */
+bool PerfCounters::isCounted(Event event) const {
+    return this->mIsCounted[event];
+}
+
+/*
+ * Divide the instructions by the cycles.
+ */
+double PerfCounters::getInstructionsPerCycle() const {
+    double ipc;
+
+    if(this->mIsCounted[CYCLES] && this->mIsCounted[INSTRUCTIONS]
+            && this->mValues[CYCLES] != 0) {
+        ipc = static_cast<double>(this->mValues[INSTRUCTIONS])
+            / static_cast<double>(this->mValues[CYCLES]);
+    } else {
+        ipc = 0.0;
+    }
+
+    return ipc;
+}
+
+/*
+ * Returns the name perf uses for the event.
+ */
+const char* PerfCounters::getName(Event event) {
+    return EVENT_CONFIGS[event].name;
+}
+
+/*
+ * Opens all events, including the hardware events.
+ */
+PerfCounterGroup::PerfCounterGroup() :
+    mLeader(-1),
+    mNumberOfEvents(0){
+    this->open(true);
+}
+
+/*
+ * Close all events.
+ */
+PerfCounterGroup::~PerfCounterGroup() {
+    this->close();
+}
+
+/*
+ * Open the hardware events first, so one of them leads the group if possible.
+ * Events that cannot be opened are skipped. The group is created disabled and
+ * enabled at once after all events are opened.
+ */
+void PerfCounterGroup::open(bool withHardware) {
+    for(int i = 0; i < PerfCounters::NUMBER_OF_EVENTS; ++i) {
+        this->mFileDescriptors[i] = -1;
+    }
+
+    for(int i = 0; i < PerfCounters::NUMBER_OF_EVENTS; ++i) {
+        PerfCounters::Event event = static_cast<PerfCounters::Event>(i);
+
+        if(!withHardware && EVENT_CONFIGS[i].type == PERF_TYPE_HARDWARE) {
+            continue;
+        }
+
+        int fd = this->openEvent(event);
+
+        if(fd != -1) {
+            if(this->mLeader == -1) {
+                this->mLeader = fd;
+            }
+
+            this->mFileDescriptors[event] = fd;
+            this->mOrder[this->mNumberOfEvents] = event;
+            ++(this->mNumberOfEvents);
+        }
+    }
+
+    if(this->mLeader != -1) {
+        ioctl(this->mLeader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(this->mLeader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+/*
+ * Close all events, the leader last.
+ */
+void PerfCounterGroup::close() {
+    for(int i = PerfCounters::NUMBER_OF_EVENTS - 1; i >= 0; --i) {
+        if(this->mFileDescriptors[i] != -1
+                && this->mFileDescriptors[i] != this->mLeader) {
+            ::close(this->mFileDescriptors[i]);
+        }
+
+        this->mFileDescriptors[i] = -1;
+    }
+
+    if(this->mLeader != -1) {
+        ::close(this->mLeader);
+    }
+
+    this->mLeader = -1;
+    this->mNumberOfEvents = 0;
+}
+
+/*
+ * Returns if at least one event has been opened.
+ */
+bool PerfCounterGroup::isAvailable() const {
+    return this->mLeader != -1;
+}
+
+/*
+ * Returns if the event has been opened.
+ */
+bool PerfCounterGroup::isCounting(PerfCounters::Event event) const {
+    return this->mFileDescriptors[event] != -1;
+}
+
+/*
+ * Returns if one of the hardware events has been opened.
+ */
+bool PerfCounterGroup::hasHardwareCounters() const {
+    for(int i = 0; i < PerfCounters::NUMBER_OF_EVENTS; ++i) {
+        if(this->mFileDescriptors[i] != -1
+                && EVENT_CONFIGS[i].type == PERF_TYPE_HARDWARE) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * A group read returns the number of events, the time enabled, the time
+ * running and the values in the order the events were opened. If the group was
+ * not running all the time, the kernel multiplexed the counters and the values
+ * are scaled up. If it was never running, the hardware events are dropped.
+ */
+bool PerfCounterGroup::read(PerfCounters& counters) {
+    std::uint64_t buffer[3 + PerfCounters::NUMBER_OF_EVENTS];
+    const ssize_t expectedSize =
+        static_cast<ssize_t>((3 + this->mNumberOfEvents) * sizeof(buffer[0]));
+
+    counters.reset();
+
+    if(this->mLeader == -1
+            || ::read(this->mLeader, buffer, sizeof(buffer)) < expectedSize
+            || buffer[0] != static_cast<std::uint64_t>(this->mNumberOfEvents)) {
+        return false;
+    }
+
+    /* the group has been enabled, but never scheduled. A hardware event that
+     * never gets the PMU stops the software events as well */
+    if(buffer[2] == 0) {
+        if(buffer[1] == 0 || !this->hasHardwareCounters()) {
+            return false;
+        }
+
+        this->close();
+        this->open(false);
+
+        return this->read(counters);
+    }
+
+    std::uint64_t enabled = buffer[1];
+    std::uint64_t running = buffer[2];
+
+    for(int i = 0; i < this->mNumberOfEvents; ++i) {
+        std::uint64_t value = buffer[3 + i];
+
+        if(running < enabled) {
+            value = static_cast<std::uint64_t>(static_cast<double>(value)
+                * static_cast<double>(enabled) / static_cast<double>(running));
+        }
+
+        counters.set(this->mOrder[i], value);
+    }
+
+    return true;
+}
+
+/*
+ * The group is a thread-local variable, since perf events count the thread
+ * that opened them.
+ */
+PerfCounterGroup& PerfCounterGroup::getThreadGroup() {
+    static thread_local PerfCounterGroup group;
+
+    return group;
+}
+
+/*
+ * Open a single event of the calling thread within the group. Kernel events
+ * are counted if permitted, otherwise only user space is counted. Returns the
+ * file descriptor or -1.
+ */
+int PerfCounterGroup::openEvent(PerfCounters::Event event) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+
+    attr.size = sizeof(attr);
+    attr.type = EVENT_CONFIGS[event].type;
+    attr.config = EVENT_CONFIGS[event].config;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED
+        | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.disabled = (this->mLeader == -1) ? 1 : 0;
+    attr.exclude_hv = 1;
+
+    int fd = perfEventOpen(&attr, this->mLeader);
+
+    if(fd == -1) {
+        attr.exclude_kernel = 1;
+        fd = perfEventOpen(&attr, this->mLeader);
+    }
+
+    return fd;
+}
@@ -0,0 +1,251 @@
+/*
+ * File:   PerfCounters.h
+ * Author: Nils Döring
+ *
+ * Created on October 17, 2026, 2:15 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PERFCOUNTERS_H
+#define	PERFCOUNTERS_H
+
+#include <cstdint>
+
+/**
+ * \brief This class stores the values of a set of performance counters.
+ *
+ * The values are either absolute readings of a PerfCounterGroup or the
+ * difference between two readings, as returned by PerfTimer. Every event is
+ * flagged whether it has been counted at all, since not every system provides
+ * all of them.
+ */
+class PerfCounters {
+public:
+    /**
+     * \brief The events counted by a PerfCounterGroup.
+     *
+     * CYCLES, INSTRUCTIONS, CACHE_MISSES and BRANCH_MISSES are hardware events
+     * of the processor. CONTEXT_SWITCHES and PAGE_FAULTS are software events of
+     * the kernel and are available on nearly every system.
+     */
+    enum Event {
+        CYCLES,
+        INSTRUCTIONS,
+        CACHE_MISSES,
+        BRANCH_MISSES,
+        CONTEXT_SWITCHES,
+        PAGE_FAULTS,
+        NUMBER_OF_EVENTS
+    };
+
+    /**
+     * \brief Default constructor.
+     *
+     * Creates an object with all values set to zero and no event counted.
+     */
+    PerfCounters();
+
+    /**
+     * \brief Copy constructor.
+     * @param orig
+     */
+    PerfCounters(const PerfCounters& orig);
+
+    /**
+     * \brief Assign the values of the other object to this object.
+     * @param rhs
+     */
+    PerfCounters& operator=(const PerfCounters& rhs);
+
+    /**
+     * \brief Adds the values of the other object to this object.
+     *
+     * Afterwards an event is counted, if it is counted in either object.
+     * @param rhs
+     */
+    PerfCounters& operator+=(const PerfCounters& rhs);
+
+    /**
+     * \brief Returns the difference of two readings.
+     *
+     * Only the events counted in both objects are counted in the result.
+     * @param rhs The earlier reading
+     */
+    const PerfCounters operator-(const PerfCounters& rhs) const;
+
+    /**
+     * \brief Checks if both objects count the same events with equal values.
+     * @param rhs
+     */
+    bool operator==(const PerfCounters& rhs) const;
+
+    /**
+     * \brief Checks if the objects differ, see operator==.
+     * @param rhs
+     */
+    bool operator!=(const PerfCounters& rhs) const;
+
+    /**
+     * \brief Sets all values to zero and marks all events as not counted.
+     */
+    void reset();
+
+    /**
+     * \brief Returns the value of the event, or zero if it is not counted.
+     * @param event
+     */
+    std::uint64_t get(Event event) const;
+
+    /**
+     * \brief Sets the value of the event and marks it as counted.
+     * @param event
+     * @param value
+     */
+    void set(Event event, std::uint64_t value);
+
+    /**
+     * \brief Returns if the event has been counted.
+     * @param event
+     */
+    bool isCounted(Event event) const;
+
+    /**
+     * \brief Returns the number of instructions per cycle.
+     *
+     * Returns 0.0, if cycles or instructions are not counted.
+     */
+    double getInstructionsPerCycle() const;
+
+    /**
+     * \brief Returns a readable name of the event, e.g. "cycles".
+     * @param event
+     */
+    static const char* getName(Event event);
+
+private:
+    std::uint64_t mValues[NUMBER_OF_EVENTS];
+    bool mIsCounted[NUMBER_OF_EVENTS];
+};
+
+/**
+ * \brief This class counts a group of performance counters of the calling
+ * thread.
+ *
+ * The counters are opened with perf_event_open() as one group, so they are
+ * scheduled together and read() returns all of them with a single system
+ * call. If the hardware events are unavailable, e.g. in containers or virtual
+ * machines, or if perf_event_paranoid forbids them, only the software events
+ * are counted. The same holds if the hardware events can be opened, but are
+ * never scheduled, e.g. since another process uses the PMU: the first read()
+ * noticing this reopens the group with the software events only. If
+ * perf_event_open() is not permitted at all, the group is not available and
+ * all readings are empty.
+ *
+ * Kernel events are excluded, if the system only allows to count user space.
+ * If the kernel multiplexes the counters, the values are scaled to the time the
+ * group was enabled.
+ *
+ * \attention The group counts the thread that constructed it. Use
+ * getThreadGroup() to obtain the group of the calling thread.
+ * \attention This class is \b NOT reentrant and \b NOT thread-safe.
+ */
+class PerfCounterGroup {
+public:
+    /**
+     * \brief Opens and enables the counters for the calling thread.
+     */
+    PerfCounterGroup();
+
+    /**
+     * \brief Copy constructor.
+     *
+     * This is deleted, since the group owns its file descriptors.
+     */
+    PerfCounterGroup(const PerfCounterGroup& orig) = delete;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * This is deleted, since the group owns its file descriptors.
+     */
+    PerfCounterGroup& operator=(const PerfCounterGroup& rhs) = delete;
+
+    /**
+     * \brief Closes the counters.
+     */
+    virtual ~PerfCounterGroup();
+
+    /**
+     * \brief Returns if at least one event is counted.
+     */
+    bool isAvailable() const;
+
+    /**
+     * \brief Returns if the event is counted.
+     * @param event
+     */
+    bool isCounting(PerfCounters::Event event) const;
+
+    /**
+     * \brief Returns if any hardware event is counted.
+     */
+    bool hasHardwareCounters() const;
+
+    /**
+     * \brief Reads all counters of the group at once.
+     *
+     * Returns false and resets the counters, if the group is not available or
+     * the read fails. If the hardware events have never been scheduled, the
+     * group is reopened without them and read again.
+     * @param counters The object to store the readings in
+     */
+    bool read(PerfCounters& counters);
+
+    /**
+     * \brief Returns the group of the calling thread.
+     *
+     * The group is opened on the first call of every thread and closed when
+     * the thread exits.
+     */
+    static PerfCounterGroup& getThreadGroup();
+
+private:
+    void open(bool withHardware);
+    void close();
+    int openEvent(PerfCounters::Event event);
+
+    int mLeader;
+    int mFileDescriptors[PerfCounters::NUMBER_OF_EVENTS];
+    PerfCounters::Event mOrder[PerfCounters::NUMBER_OF_EVENTS];
+    int mNumberOfEvents;
+};
+
+#endif	/* PERFCOUNTERS_H */
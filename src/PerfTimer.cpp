@@ -0,0 +1,265 @@
+/*
+ * File:   PerfTimer.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 17, 2026, 3:05 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "PerfTimer.h"
+
+/*
+ * Create a new PerfTimer on the group of the calling thread.
+ */
+template<class Clock>
+BasicPerfTimer<Clock>::BasicPerfTimer() :
+    BasicPerfTimer(PerfCounterGroup::getThreadGroup()){
+}
+
+/*
+ * Create a new PerfTimer on the given group.
+ */
+template<class Clock>
+BasicPerfTimer<Clock>::BasicPerfTimer(PerfCounterGroup& group) :
+    mTimer(),
+    mGroup(&group),
+    mStartCounters(),
+    mCounters(){
+}
+
+/*
+ * Copy the readings and the state. Both objects read the same group.
+ */
+template<class Clock>
+BasicPerfTimer<Clock>::BasicPerfTimer(const BasicPerfTimer& orig) :
+    mTimer(orig.mTimer),
+    mGroup(orig.mGroup),
+    mStartCounters(orig.mStartCounters),
+    mCounters(orig.mCounters){
+}
+
+/*
+ * Destructor. The group is not owned.
+ */
+template<class Clock>
+BasicPerfTimer<Clock>::~BasicPerfTimer() {
+}
+
+/*
+ * Assign the readings, the state and the group.
+ */
+template<class Clock>
+BasicPerfTimer<Clock>&
+BasicPerfTimer<Clock>::operator=(const BasicPerfTimer& rhs) {
+    this->mTimer = rhs.mTimer;
+    this->mGroup = rhs.mGroup;
+    this->mStartCounters = rhs.mStartCounters;
+    this->mCounters = rhs.mCounters;
+
+    return *this;
+}
+
+/*
+ * The counters are read before the clock, so they include the clock reading
+ * and not the other way round.
+ */
+template<class Clock>
+void BasicPerfTimer<Clock>::start() {
+    if(this->mTimer.isReset() and !this->mTimer.isRunning()) {
+        this->mGroup->read(this->mStartCounters);
+        this->mTimer.start();
+    }
+}
+
+/*
+ * Stop the clock first and read the counters afterwards. If the timer is
+ * paused, the counters have already been added up by pause().
+ */
+template<class Clock>
+void BasicPerfTimer<Clock>::stop() {
+    if(!this->mTimer.isReset() and this->mTimer.isRunning()) {
+        bool wasPaused = this->mTimer.isPaused();
+
+        this->mTimer.stop();
+
+        if(!wasPaused) {
+            PerfCounters stopCounters;
+            this->mGroup->read(stopCounters);
+            this->mCounters += stopCounters - this->mStartCounters;
+        }
+    }
+}
+
+/*
+ * Add up the counters until the pause.
+ */
+template<class Clock>
+void BasicPerfTimer<Clock>::pause() {
+    if(this->mTimer.isRunning() and !this->mTimer.isPaused()) {
+        PerfCounters pauseCounters;
+
+        this->mTimer.pause();
+        this->mGroup->read(pauseCounters);
+        this->mCounters += pauseCounters - this->mStartCounters;
+    }
+}
+
+/*
+ * Start counting again.
+ */
+template<class Clock>
+void BasicPerfTimer<Clock>::resume() {
+    if(this->mTimer.isPaused()) {
+        this->mGroup->read(this->mStartCounters);
+        this->mTimer.resume();
+    }
+}
+
+/*
+ * Reset the timer and the counters.
+ */
+template<class Clock>
+void BasicPerfTimer<Clock>::reset() {
+    this->mTimer.reset();
+    this->mStartCounters.reset();
+    this->mCounters.reset();
+}
+
+/*
+ * Returns if the timer is running.
+ */
+template<class Clock>
+bool BasicPerfTimer<Clock>::isRunning() const {
+    return this->mTimer.isRunning();
+}
+
+/*
+ * Returns if the timer is paused.
+ */
+template<class Clock>
+bool BasicPerfTimer<Clock>::isPaused() const {
+    return this->mTimer.isPaused();
+}
+
+/*
+ * Returns if the timer is reset.
+ */
+template<class Clock>
+bool BasicPerfTimer<Clock>::isReset() const {
+    return this->mTimer.isReset();
+}
+
+/*
+ * Returns the duration.
+ */
+template<class Clock>
+const Timestamp BasicPerfTimer<Clock>::getTime() const {
+    return this->mTimer.getTime();
+}
+
+/*
+ * Returns the duration in seconds.
+ */
+template<class Clock>
+double BasicPerfTimer<Clock>::getTimeInSeconds() const {
+    return this->mTimer.getTimeInSeconds();
+}
+
+/*
+ * Returns the duration in milliseconds.
+ */
+template<class Clock>
+double BasicPerfTimer<Clock>::getTimeInMilliSeconds() const {
+    return this->mTimer.getTimeInMilliSeconds();
+}
+
+/*
+ * Returns the duration in microseconds.
+ */
+template<class Clock>
+double BasicPerfTimer<Clock>::getTimeInMicroSeconds() const {
+    return this->mTimer.getTimeInMicroSeconds();
+}
+
+/*
+ * Returns the duration in nanoseconds.
+ */
+template<class Clock>
+double BasicPerfTimer<Clock>::getTimeInNanoSeconds() const {
+    return this->mTimer.getTimeInNanoSeconds();
+}
+
+/*
+ * Returns the frequency of the duration.
+ */
+template<class Clock>
+double BasicPerfTimer<Clock>::getFrequency() const {
+    return this->mTimer.getFrequency();
+}
+
+/*
+ * Returns the counted events.
+ */
+template<class Clock>
+const PerfCounters& BasicPerfTimer<Clock>::getCounters() const {
+    return this->mCounters;
+}
+
+/*
+ * Returns the number of events of the given kind.
+ */
+template<class Clock>
+std::uint64_t BasicPerfTimer<Clock>::getCount(PerfCounters::Event event) const {
+    return this->mCounters.get(event);
+}
+
+/*
+ * Compares the timer, see Timer::isEqual(), and the counted events.
+ */
+template<class Clock>
+bool BasicPerfTimer<Clock>::isEqual(const BasicPerfTimer& rhs) const {
+    return this->mTimer.isEqual(rhs.mTimer)
+        && this->mCounters == rhs.mCounters;
+}
+
+/*
+ * Returns the timer.
+ */
+template<class Clock>
+const BasicTimer<Clock>& BasicPerfTimer<Clock>::getTimer() const {
+    return this->mTimer;
+}
+
+template class BasicPerfTimer<RealtimeClock>;
+template class BasicPerfTimer<MonotonicClock>;
+template class BasicPerfTimer<MonotonicRawClock>;
+template class BasicPerfTimer<BoottimeClock>;
+template class BasicPerfTimer<TscClock>;
@@ -0,0 +1,213 @@
+/*
+ * File:   PerfTimer.h
+ * Author: Nils Döring
+ *
+ * Created on October 17, 2026, 3:05 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PERFTIMER_H
+#define	PERFTIMER_H
+
+#include <cstdint>
+#include "Timestamp.h"
+#include "Clock.h"
+#include "Timer.h"
+#include "PerfCounters.h"
+
+/**
+ * \brief This class measures a duration together with performance counters.
+ *
+ * A PerfTimer reads a PerfCounterGroup on start() and stop() and stores the
+ * difference of the counters next to the duration. So a slower duration can be
+ * explained by e.g. more cache misses, branch misses or context switches.
+ * Paused time is excluded from the counters as well.
+ *
+ * Each reading of the counters is a single read() system call on the group,
+ * which costs in the order of a microsecond. Use Timer or FastTimer for very
+ * short durations.
+ *
+ * \attention The counters are the ones of the calling thread. Start and stop
+ * a PerfTimer on the thread its PerfCounterGroup belongs to.
+ * \attention This class is \b NOT reentrant and \b NOT thread-safe.
+ * \tparam Clock One of the wall-clock policies defined in Clock.h.
+ */
+template<class Clock>
+class BasicPerfTimer {
+public:
+    /**
+     * \brief Default constructor.
+     *
+     * Creates a PerfTimer reading the PerfCounterGroup of the calling thread.
+     */
+    BasicPerfTimer();
+
+    /**
+     * \brief Creates a PerfTimer reading the given group.
+     * @param group The group has to outlive the PerfTimer.
+     */
+    explicit BasicPerfTimer(PerfCounterGroup& group);
+
+    /**
+     * \brief Copy constructor.
+     *
+     * The copy reads the same PerfCounterGroup.
+     * @param orig
+     */
+    BasicPerfTimer(const BasicPerfTimer& orig);
+
+    /**
+     * \brief Standard destructor.
+     */
+    virtual ~BasicPerfTimer();
+
+    /**
+     * \brief Assign the values of the other PerfTimer to this object.
+     * @param rhs
+     */
+    BasicPerfTimer& operator=(const BasicPerfTimer& rhs);
+
+    /**
+     * \brief Start the timer and the counters.
+     *
+     * \attention This method fails silently, like Timer::start().
+     */
+    void start();
+
+    /**
+     * \brief Stop a running timer and store the counted events.
+     *
+     * \attention This method fails silently, like Timer::stop().
+     */
+    void stop();
+
+    /**
+     * \brief Pause a running timer.
+     *
+     * \attention This method fails silently, like Timer::pause().
+     */
+    void pause();
+
+    /**
+     * \brief Resume a paused timer.
+     *
+     * \attention This method fails silently, like Timer::resume().
+     */
+    void resume();
+
+    /**
+     * \brief Reset the timer and the counters.
+     */
+    void reset();
+
+    /**
+     * \brief Return if the timer is running.
+     */
+    bool isRunning() const;
+
+    /**
+     * \brief Return if the timer is paused.
+     */
+    bool isPaused() const;
+
+    /**
+     * \brief Return if the timer is reset.
+     */
+    bool isReset() const;
+
+    /**
+     * \brief Returns the duration.
+     */
+    const Timestamp getTime() const;
+
+    /**
+     * \brief Returns the duration in seconds.
+     */
+    double getTimeInSeconds() const;
+
+    /**
+     * \brief Returns the duration in milliseconds.
+     */
+    double getTimeInMilliSeconds() const;
+
+    /**
+     * \brief Returns the duration in microseconds.
+     */
+    double getTimeInMicroSeconds() const;
+
+    /**
+     * \brief Returns the duration in nanoseconds.
+     */
+    double getTimeInNanoSeconds() const;
+
+    /**
+     * \brief Returns the frequency resulting from the duration.
+     */
+    double getFrequency() const;
+
+    /**
+     * \brief Returns the events counted between start() and stop().
+     */
+    const PerfCounters& getCounters() const;
+
+    /**
+     * \brief Returns the number of events of the given kind.
+     *
+     * Returns 0, if the event is not counted on this system.
+     * @param event
+     */
+    std::uint64_t getCount(PerfCounters::Event event) const;
+
+    /**
+     * \brief Checks whether both timers have the same readings and counters.
+     * @param rhs
+     */
+    bool isEqual(const BasicPerfTimer& rhs) const;
+
+    /**
+     * \brief Returns the Timer measuring the duration.
+     */
+    const BasicTimer<Clock>& getTimer() const;
+
+private:
+    BasicTimer<Clock> mTimer;
+    PerfCounterGroup* mGroup;
+    PerfCounters mStartCounters;
+    PerfCounters mCounters;
+};
+
+/**
+ * \brief The default PerfTimer, measuring the duration with the monotonic
+ * clock.
+ */
+typedef BasicPerfTimer<MonotonicClock> PerfTimer;
+
+#endif	/* PERFTIMER_H */
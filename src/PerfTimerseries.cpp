@@ -0,0 +1,139 @@
+/*
+ * File:   PerfTimerseries.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 17, 2026, 3:40 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "PerfTimerseries.h"
+
+#include <utility>
+
+/*
+ * Creates an empty series.
+ */
+template<class Clock>
+BasicPerfTimerseries<Clock>::BasicPerfTimerseries() :
+    BasicTimerseries<Clock, BasicPerfTimer<Clock> >(){
+}
+
+/*
+ * Copies all PerfTimer of the original series.
+ */
+template<class Clock>
+BasicPerfTimerseries<Clock>::BasicPerfTimerseries(
+        const BasicPerfTimerseries& orig) :
+    BasicTimerseries<Clock, BasicPerfTimer<Clock> >(orig){
+}
+
+/*
+ * Takes over all PerfTimer of the original series.
+ */
+template<class Clock>
+BasicPerfTimerseries<Clock>::BasicPerfTimerseries(
+        BasicPerfTimerseries&& orig) :
+    BasicTimerseries<Clock, BasicPerfTimer<Clock> >(std::move(orig)){
+}
+
+/*
+ * Copies all PerfTimer of rhs, see Timerseries::operator=().
+ */
+template<class Clock>
+BasicPerfTimerseries<Clock>& BasicPerfTimerseries<Clock>::operator=(
+        const BasicPerfTimerseries& rhs) {
+    BasicTimerseries<Clock, BasicPerfTimer<Clock> >::operator=(rhs);
+
+    return *this;
+}
+
+/*
+ * Takes over all PerfTimer of rhs, see Timerseries::operator=().
+ */
+template<class Clock>
+BasicPerfTimerseries<Clock>& BasicPerfTimerseries<Clock>::operator=(
+        BasicPerfTimerseries&& rhs) {
+    BasicTimerseries<Clock, BasicPerfTimer<Clock> >::operator=(std::move(rhs));
+
+    return *this;
+}
+
+/*
+ * The PerfTimer are destroyed by the base class.
+ */
+template<class Clock>
+BasicPerfTimerseries<Clock>::~BasicPerfTimerseries() {
+}
+
+/*
+ * Returns a new list with the number of events of each PerfTimer.
+ */
+template<class Clock>
+std::list<double>*
+BasicPerfTimerseries<Clock>::getCounts(PerfCounters::Event event) const {
+    std::list<double>* counts = new std::list<double>();
+
+    for(const BasicPerfTimer<Clock>* timer: this->getTimer()){
+        counts->push_back(static_cast<double>(timer->getCount(event)));
+    }
+
+    return counts;
+}
+
+/*
+ * Returns a new list with the instructions per cycle of each PerfTimer.
+ */
+template<class Clock>
+std::list<double>*
+BasicPerfTimerseries<Clock>::getInstructionsPerCycle() const {
+    std::list<double>* ipcs = new std::list<double>();
+
+    for(const BasicPerfTimer<Clock>* timer: this->getTimer()){
+        ipcs->push_back(timer->getCounters().getInstructionsPerCycle());
+    }
+
+    return ipcs;
+}
+
+/*
+ * The Statistic takes ownership of the list of counts.
+ */
+template<class Clock>
+Statistic*
+BasicPerfTimerseries<Clock>::getStatistic(PerfCounters::Event event) const {
+    return new Statistic(this->getCounts(event));
+}
+
+template class BasicPerfTimerseries<RealtimeClock>;
+template class BasicPerfTimerseries<MonotonicClock>;
+template class BasicPerfTimerseries<MonotonicRawClock>;
+template class BasicPerfTimerseries<BoottimeClock>;
+template class BasicPerfTimerseries<TscClock>;
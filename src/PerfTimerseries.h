@@ -0,0 +1,136 @@
+/*
+ * File:   PerfTimerseries.h
+ * Author: Nils Döring
+ *
+ * Created on October 17, 2026, 3:40 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PERFTIMERSERIES_H
+#define	PERFTIMERSERIES_H
+
+#include <list>
+#include "PerfCounters.h"
+#include "PerfTimer.h"
+#include "Timerseries.h"
+#include "Statistic.h"
+
+/**
+ * \brief This class stores series of PerfTimer.
+ *
+ * In addition to the durations, this class returns the counted events of every
+ * PerfTimer as a series, or directly as a Statistic per event.
+ *
+ * \attention This class is \b NOT reentrant and \b NOT thread-safe.
+ * \tparam Clock One of the wall-clock policies defined in Clock.h.
+ */
+template<class Clock>
+class BasicPerfTimerseries :
+    public BasicTimerseries<Clock, BasicPerfTimer<Clock> > {
+public:
+    /**
+     * \brief Default constructor.
+     *
+     * Creates a new PerfTimerseries with an empty container for PerfTimer.
+     */
+    BasicPerfTimerseries();
+
+    /**
+     * \brief Copy constructor.
+     *
+     * \attention All PerfTimer are copied.
+     * @param orig
+     */
+    BasicPerfTimerseries(const BasicPerfTimerseries& orig);
+
+    /**
+     * \brief Move constructor.
+     *
+     * Takes over all PerfTimer of the original series without copying them.
+     * @param orig
+     */
+    BasicPerfTimerseries(BasicPerfTimerseries&& orig);
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \attention All PerfTimer of rhs are copied.
+     * @param rhs
+     */
+    BasicPerfTimerseries& operator=(const BasicPerfTimerseries& rhs);
+
+    /**
+     * \brief Move assignment operator.
+     *
+     * Takes over all PerfTimer of rhs without copying them.
+     * @param rhs
+     */
+    BasicPerfTimerseries& operator=(BasicPerfTimerseries&& rhs);
+
+    /**
+     * \brief Standard destructor.
+     *
+     * All contained PerfTimer are destroyed.
+     */
+    virtual ~BasicPerfTimerseries();
+
+    /**
+     * \brief Returns the number of events of all PerfTimer.
+     *
+     * The returned list has to be deleted by the caller. It can be passed to
+     * Statistic.
+     * @param event
+     */
+    std::list<double>* getCounts(PerfCounters::Event event) const;
+
+    /**
+     * \brief Returns the instructions per cycle of all PerfTimer.
+     *
+     * See PerfCounters::getInstructionsPerCycle().
+     */
+    std::list<double>* getInstructionsPerCycle() const;
+
+    /**
+     * \brief Returns the statistic of the number of events of all PerfTimer.
+     *
+     * The returned object has to be deleted by the caller.
+     * @param event
+     */
+    Statistic* getStatistic(PerfCounters::Event event) const;
+};
+
+/**
+ * \brief The default PerfTimerseries, holding PerfTimer measuring with the
+ * monotonic clock.
+ */
+typedef BasicPerfTimerseries<MonotonicClock> PerfTimerseries;
+
+#endif	/* PERFTIMERSERIES_H */
@@ -0,0 +1,254 @@
+/*
+ * File:   ReservoirTimerseries.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 21, 2026, 10:05 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "ReservoirTimerseries.h"
+
+#include <cmath>
+#include <limits>
+
+/*
+ * Reserves the whole sample, so adding measurements never allocates.
+ */
+template<class Clock>
+BasicReservoirTimerseries<Clock>::BasicReservoirTimerseries(
+        std::size_t capacity) :
+    BasicReservoirTimerseries(capacity, std::random_device()()) {
+}
+
+/*
+ * Reserves the whole sample, so adding measurements never allocates.
+ */
+template<class Clock>
+BasicReservoirTimerseries<Clock>::BasicReservoirTimerseries(
+        std::size_t capacity, std::uint64_t seed) :
+    mStartTimes(),
+    mStopTimes(),
+    mCapacity(capacity),
+    mTotalCount(0),
+    mNextIndex(0),
+    mWeight(1.0),
+    mRandom(seed) {
+    this->mStartTimes.reserve(capacity);
+    this->mStopTimes.reserve(capacity);
+}
+
+/*
+ * The arrays free themselves.
+ */
+template<class Clock>
+BasicReservoirTimerseries<Clock>::~BasicReservoirTimerseries() {
+}
+
+/*
+ * The stop reading is the start plus the elapsed ticks, so the paused time is
+ * left out. Timers that are reset or still running are skipped.
+ */
+template<class Clock>
+BasicReservoirTimerseries<Clock>&
+BasicReservoirTimerseries<Clock>::operator+=(const BasicTimer<Clock>& timer) {
+    if(timer.isRunning() or timer.isReset()) {
+        return *this;
+    }
+
+    this->append(timer.getStartTicks(),
+        timer.getStartTicks() + timer.getElapsedTicks());
+
+    return *this;
+}
+
+/*
+ * Adds both readings of the FastTimer.
+ */
+template<class Clock>
+BasicReservoirTimerseries<Clock>&
+BasicReservoirTimerseries<Clock>::operator+=(
+        const BasicFastTimer<Clock>& timer) {
+    this->append(timer.getStartTime(), timer.getStopTime());
+
+    return *this;
+}
+
+/*
+ * The sample is filled first. Afterwards only the measurement at mNextIndex
+ * replaces a random one of the sample, all others are just counted.
+ */
+template<class Clock>
+void BasicReservoirTimerseries<Clock>::append(std::int64_t startTime,
+        std::int64_t stopTime) {
+    if(this->mCapacity == 0) {
+        ++(this->mTotalCount);
+        return;
+    }
+
+    if(this->mStartTimes.size() < this->mCapacity) {
+        this->mStartTimes.push_back(startTime);
+        this->mStopTimes.push_back(stopTime);
+
+        if(this->mStartTimes.size() == this->mCapacity) {
+            this->mWeight =
+                std::exp(std::log(this->random()) / this->mCapacity);
+            this->mNextIndex = this->mTotalCount + 1;
+            this->drawNextIndex();
+        }
+    } else if(this->mTotalCount == this->mNextIndex) {
+        std::size_t slot = static_cast<std::size_t>(
+            this->mRandom() % this->mCapacity);
+
+        this->mStartTimes[slot] = startTime;
+        this->mStopTimes[slot] = stopTime;
+
+        this->mWeight *= std::exp(std::log(this->random()) / this->mCapacity);
+        this->mNextIndex = this->mTotalCount + 1;
+        this->drawNextIndex();
+    }
+
+    ++(this->mTotalCount);
+}
+
+/*
+ * Keeps the memory and restarts the sample.
+ */
+template<class Clock>
+void BasicReservoirTimerseries<Clock>::clear() {
+    this->mStartTimes.clear();
+    this->mStopTimes.clear();
+    this->mTotalCount = 0;
+    this->mNextIndex = 0;
+    this->mWeight = 1.0;
+}
+
+/*
+ * Returns the number of kept measurements.
+ */
+template<class Clock>
+std::size_t BasicReservoirTimerseries<Clock>::getSize() const {
+    return this->mStartTimes.size();
+}
+
+/*
+ * Returns the size of a full sample.
+ */
+template<class Clock>
+std::size_t BasicReservoirTimerseries<Clock>::getCapacity() const {
+    return this->mCapacity;
+}
+
+/*
+ * Returns the number of all measurements.
+ */
+template<class Clock>
+std::uint64_t BasicReservoirTimerseries<Clock>::getTotalCount() const {
+    return this->mTotalCount;
+}
+
+/*
+ * Appends the sample to the cleared series.
+ */
+template<class Clock>
+std::size_t BasicReservoirTimerseries<Clock>::getSample(
+        BasicContiguousTimerseries<Clock>& series) const {
+    std::size_t size = this->mStartTimes.size();
+
+    series.clear();
+    series.reserve(size);
+
+    for(std::size_t i = 0; i < size; ++i) {
+        series.append(this->mStartTimes[i], this->mStopTimes[i]);
+    }
+
+    return size;
+}
+
+/*
+ * The view reads directly from both arrays.
+ */
+template<class Clock>
+ReadingsView<Clock> BasicReservoirTimerseries<Clock>::view(
+        typename ReadingsView<Clock>::Unit unit) const {
+    return ReadingsView<Clock>(this->mStartTimes.data(),
+        this->mStopTimes.data(), this->mStartTimes.size(), unit);
+}
+
+/*
+ * The Statistic is calculated from the sample and knows the size of the
+ * population.
+ */
+template<class Clock>
+Statistic* BasicReservoirTimerseries<Clock>::getStatistic(
+        typename ReadingsView<Clock>::Unit unit) const {
+    ReadingsView<Clock> view = this->view(unit);
+    Statistic* statistic = new Statistic(view.begin(), view.end());
+
+    statistic->setPopulationSize(this->mTotalCount);
+
+    return statistic;
+}
+
+/*
+ * Returns a random number in the open interval (0, 1), so its logarithm is
+ * finite. The 53 bits fill the mantissa of a double.
+ */
+template<class Clock>
+double BasicReservoirTimerseries<Clock>::random() {
+    return ((this->mRandom() >> 11) + 0.5) / 9007199254740992.0;
+}
+
+/*
+ * Skips a geometrically distributed number of measurements. A weight close to
+ * 0 can skip more measurements than can ever be counted.
+ */
+template<class Clock>
+void BasicReservoirTimerseries<Clock>::drawNextIndex() {
+    double skip = std::floor(std::log(this->random())
+        / std::log1p(-this->mWeight));
+    double remaining = static_cast<double>(
+        std::numeric_limits<std::uint64_t>::max() - this->mNextIndex);
+
+    if(skip < remaining) {
+        this->mNextIndex += static_cast<std::uint64_t>(skip);
+    } else {
+        this->mNextIndex = std::numeric_limits<std::uint64_t>::max();
+    }
+}
+
+template class BasicReservoirTimerseries<RealtimeClock>;
+template class BasicReservoirTimerseries<MonotonicClock>;
+template class BasicReservoirTimerseries<MonotonicRawClock>;
+template class BasicReservoirTimerseries<BoottimeClock>;
+template class BasicReservoirTimerseries<ProcessCpuClock>;
+template class BasicReservoirTimerseries<ThreadCpuClock>;
+template class BasicReservoirTimerseries<TscClock>;
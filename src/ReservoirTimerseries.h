@@ -0,0 +1,195 @@
+/*
+ * File:   ReservoirTimerseries.h
+ * Author: Nils Döring
+ *
+ * Created on October 21, 2026, 10:05 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef RESERVOIRTIMERSERIES_H
+#define	RESERVOIRTIMERSERIES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "Clock.h"
+#include "Timer.h"
+#include "FastTimer.h"
+#include "ContiguousTimerseries.h"
+#include "Statistic.h"
+#include "TimeView.h"
+
+/**
+ * \brief This class keeps a uniform random sample of all measurements.
+ *
+ * A ReservoirTimerseries has a fixed capacity, the size of its sample. Until
+ * it is full, every measurement is kept. Afterwards, every measurement ever
+ * added has the same chance to be part of the sample. The exact number of all
+ * measurements is counted as well. This allows to time endpoints with far too
+ * many measurements to store each one, while the quartiles of the sample
+ * still represent all of them:
+ *
+ * \code
+ * ReservoirTimerseries reservoir(4096);
+ * ...
+ * reservoir += timer;
+ * ...
+ * Statistic* statistic =
+ *     reservoir.getStatistic(ReadingsView<MonotonicClock>::MICROSECONDS);
+ * statistic->getNumberOfElements();  // the size of the sample
+ * statistic->getPopulationSize();    // the number of all measurements
+ * \endcode
+ *
+ * The sample is drawn with Algorithm L by Li (1994): instead of a random
+ * number per measurement, the number of measurements to skip until the next
+ * one to keep is drawn. Adding a skipped measurement only increments a
+ * counter.
+ *
+ * \attention This class is not thread-safe.
+ * \tparam Clock One of the clock policies defined in Clock.h.
+ */
+template<class Clock>
+class BasicReservoirTimerseries {
+public:
+    /**
+     * \brief Creates a reservoir for a sample of capacity measurements.
+     *
+     * The random numbers are seeded by std::random_device.
+     * @param capacity
+     */
+    explicit BasicReservoirTimerseries(std::size_t capacity);
+
+    /**
+     * \brief Creates a reservoir with a fixed seed.
+     *
+     * The same seed and the same measurements result in the same sample.
+     * @param capacity
+     * @param seed
+     */
+    BasicReservoirTimerseries(std::size_t capacity, std::uint64_t seed);
+
+    /**
+     * \brief Standard destructor.
+     */
+    virtual ~BasicReservoirTimerseries();
+
+    /**
+     * \brief Adds the measurement of the stopped Timer.
+     *
+     * A Timer that is reset or still running is skipped and not counted.
+     * @param timer
+     */
+    BasicReservoirTimerseries& operator+=(const BasicTimer<Clock>& timer);
+
+    /**
+     * \brief Adds the measurement of the FastTimer.
+     * @param timer
+     */
+    BasicReservoirTimerseries& operator+=(const BasicFastTimer<Clock>& timer);
+
+    /**
+     * \brief Adds a measurement given by two raw clock readings.
+     *
+     * The measurement is either kept in the sample, replacing a random one, or
+     * only counted.
+     * @param startTime
+     * @param stopTime
+     */
+    void append(std::int64_t startTime, std::int64_t stopTime);
+
+    /**
+     * \brief Removes the sample and resets the count.
+     */
+    void clear();
+
+    /**
+     * \brief Returns the number of measurements in the sample.
+     */
+    std::size_t getSize() const;
+
+    /**
+     * \brief Returns the maximum number of measurements in the sample.
+     */
+    std::size_t getCapacity() const;
+
+    /**
+     * \brief Returns the number of all measurements ever added.
+     */
+    std::uint64_t getTotalCount() const;
+
+    /**
+     * \brief Copies the sample into the series.
+     *
+     * The series is cleared first. The order of the measurements is not the
+     * order they were added in. Returns the size of the sample.
+     * @param series
+     */
+    std::size_t getSample(BasicContiguousTimerseries<Clock>& series) const;
+
+    /**
+     * \brief Returns a lazy view on the sample in the given unit.
+     *
+     * The view is invalidated by adding a measurement.
+     * @param unit
+     */
+    ReadingsView<Clock> view(typename ReadingsView<Clock>::Unit unit) const;
+
+    /**
+     * \brief Returns the Statistic of the sample.
+     *
+     * The population size of the Statistic is the number of all measurements.
+     * The caller has to delete the Statistic.
+     * @param unit The unit of the durations, e.g. ReadingsView::MICROSECONDS
+     */
+    Statistic* getStatistic(typename ReadingsView<Clock>::Unit unit) const;
+
+private:
+    double random();
+    void drawNextIndex();
+
+    std::vector<std::int64_t> mStartTimes;
+    std::vector<std::int64_t> mStopTimes;
+    std::size_t mCapacity;
+    std::uint64_t mTotalCount;
+
+    /* the index of the next measurement to keep and the weight W of
+     * Algorithm L */
+    std::uint64_t mNextIndex;
+    double mWeight;
+
+    std::mt19937_64 mRandom;
+};
+
+typedef BasicReservoirTimerseries<MonotonicClock> ReservoirTimerseries;
+
+#endif	/* RESERVOIRTIMERSERIES_H */
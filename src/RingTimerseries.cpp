@@ -0,0 +1,209 @@
+/*
+ * File:   RingTimerseries.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 19, 2026, 9:45 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "RingTimerseries.h"
+
+/*
+ * Round the capacity up to a power of two, so the slot of an index is found
+ * with a mask. A capacity of zero is raised to one.
+ */
+template<class Clock>
+BasicRingTimerseries<Clock>::BasicRingTimerseries(std::size_t capacity) :
+    mSlots(nullptr),
+    mMask(0),
+    mHead(0){
+    std::size_t size = 1;
+
+    while(size < capacity) {
+        size <<= 1;
+    }
+
+    this->mSlots = new Slot[size];
+    this->mMask = size - 1;
+
+    for(std::size_t i = 0; i < size; ++i) {
+        this->mSlots[i].mSequence.store(0, std::memory_order_relaxed);
+        this->mSlots[i].mStartTime.store(0, std::memory_order_relaxed);
+        this->mSlots[i].mStopTime.store(0, std::memory_order_relaxed);
+    }
+}
+
+/*
+ * Free the ring buffer.
+ */
+template<class Clock>
+BasicRingTimerseries<Clock>::~BasicRingTimerseries() {
+    delete[] this->mSlots;
+}
+
+/*
+ * The stop reading is the start plus the elapsed ticks, so the paused time is
+ * left out. Timers that are reset or still running are skipped.
+ */
+template<class Clock>
+BasicRingTimerseries<Clock>&
+BasicRingTimerseries<Clock>::operator+=(const BasicTimer<Clock>& timer) {
+    if(timer.isRunning() or timer.isReset()) {
+        return *this;
+    }
+
+    std::int64_t startTime = timer.getStartTicks();
+
+    this->append(startTime, startTime + timer.getElapsedTicks());
+
+    return *this;
+}
+
+/*
+ * Copy both readings of the FastTimer.
+ */
+template<class Clock>
+BasicRingTimerseries<Clock>&
+BasicRingTimerseries<Clock>::operator+=(const BasicFastTimer<Clock>& timer) {
+    this->append(timer.getStartTime(), timer.getStopTime());
+
+    return *this;
+}
+
+/*
+ * Write the slot like a sequence lock: mark it as being written, store the
+ * readings and mark it as written. The release fence keeps the readings from
+ * becoming visible before the mark. Publishing the head last lets readers find
+ * the measurement.
+ */
+template<class Clock>
+void BasicRingTimerseries<Clock>::append(std::int64_t startTime,
+        std::int64_t stopTime) {
+    std::uint64_t index = this->mHead.load(std::memory_order_relaxed);
+    Slot& slot = this->mSlots[index & this->mMask];
+
+    slot.mSequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.mStartTime.store(startTime, std::memory_order_relaxed);
+    slot.mStopTime.store(stopTime, std::memory_order_relaxed);
+
+    slot.mSequence.store(2 * index + 2, std::memory_order_release);
+    this->mHead.store(index + 1, std::memory_order_release);
+}
+
+/*
+ * Read the slots of the requested indices from the oldest to the newest. A
+ * slot is only used, if its sequence shows the expected index before and after
+ * reading it. Otherwise the writer has overwritten it in the meantime.
+ */
+template<class Clock>
+std::size_t BasicRingTimerseries<Clock>::snapshot(
+        BasicContiguousTimerseries<Clock>& series, std::size_t count) const {
+    std::uint64_t head = this->mHead.load(std::memory_order_acquire);
+    std::uint64_t available = head < this->mMask + 1 ? head : this->mMask + 1;
+    std::uint64_t first = head - (count < available ? count : available);
+    std::size_t appended = 0;
+
+    series.reserve(series.getSize() + (head - first));
+
+    for(std::uint64_t index = first; index < head; ++index) {
+        const Slot& slot = this->mSlots[index & this->mMask];
+
+        std::uint64_t sequence = slot.mSequence.load(std::memory_order_acquire);
+        std::int64_t startTime =
+            slot.mStartTime.load(std::memory_order_relaxed);
+        std::int64_t stopTime = slot.mStopTime.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if(sequence == 2 * index + 2 and
+                slot.mSequence.load(std::memory_order_relaxed) == sequence) {
+            series.append(startTime, stopTime);
+            ++appended;
+        }
+    }
+
+    return appended;
+}
+
+/*
+ * Take a snapshot of the whole ring buffer.
+ */
+template<class Clock>
+std::size_t BasicRingTimerseries<Clock>::snapshot(
+        BasicContiguousTimerseries<Clock>& series) const {
+    return this->snapshot(series, this->getCapacity());
+}
+
+/*
+ * The size grows up to the capacity and stays there.
+ */
+template<class Clock>
+std::size_t BasicRingTimerseries<Clock>::getSize() const {
+    std::uint64_t head = this->mHead.load(std::memory_order_acquire);
+
+    return head < this->mMask + 1 ? static_cast<std::size_t>(head)
+        : this->mMask + 1;
+}
+
+/*
+ * Returns the number of slots.
+ */
+template<class Clock>
+std::size_t BasicRingTimerseries<Clock>::getCapacity() const {
+    return this->mMask + 1;
+}
+
+/*
+ * The head counts every measurement ever added.
+ */
+template<class Clock>
+std::uint64_t BasicRingTimerseries<Clock>::getTotalCount() const {
+    return this->mHead.load(std::memory_order_acquire);
+}
+
+/*
+ * Everything beyond the capacity has been overwritten.
+ */
+template<class Clock>
+std::uint64_t BasicRingTimerseries<Clock>::getOverwrittenCount() const {
+    std::uint64_t head = this->mHead.load(std::memory_order_acquire);
+
+    return head > this->mMask + 1 ? head - (this->mMask + 1) : 0;
+}
+
+template class BasicRingTimerseries<RealtimeClock>;
+template class BasicRingTimerseries<MonotonicClock>;
+template class BasicRingTimerseries<MonotonicRawClock>;
+template class BasicRingTimerseries<BoottimeClock>;
+template class BasicRingTimerseries<ProcessCpuClock>;
+template class BasicRingTimerseries<ThreadCpuClock>;
+template class BasicRingTimerseries<TscClock>;
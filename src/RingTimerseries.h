@@ -0,0 +1,186 @@
+/*
+ * File:   RingTimerseries.h
+ * Author: Nils Döring
+ *
+ * Created on October 19, 2026, 9:45 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef RINGTIMERSERIES_H
+#define	RINGTIMERSERIES_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "Clock.h"
+#include "Timer.h"
+#include "FastTimer.h"
+#include "ContiguousTimerseries.h"
+
+/**
+ * \brief This class keeps the most recent measurements in a ring buffer.
+ *
+ * A RingTimerseries has a fixed capacity. Once it is full, every new
+ * measurement overwrites the oldest one. The memory is allocated by the
+ * constructor, so recording never allocates and the memory stays constant,
+ * which allows to keep timing enabled all the time.
+ *
+ * One thread records the measurements, while any number of other threads may
+ * take snapshots of the most recent ones at the same time. Neither side takes
+ * a lock: every slot is guarded by a sequence number, and a reader skips the
+ * slots that are overwritten while it reads them. A snapshot is stored in a
+ * ContiguousTimerseries, e.g. to calculate a Statistic:
+ *
+ * \code
+ * ContiguousTimerseries recent;
+ * ring.snapshot(recent, 1000);
+ * Statistic statistic(recent.getTimesInMicroSeconds());
+ * \endcode
+ *
+ * \attention Only one thread at a time may add measurements. snapshot() and
+ * the getters are thread-safe.
+ * \tparam Clock One of the clock policies defined in Clock.h.
+ */
+template<class Clock>
+class BasicRingTimerseries {
+public:
+    /**
+     * \brief Creates a ring buffer for the given number of measurements.
+     *
+     * The capacity is rounded up to the next power of two.
+     * @param capacity
+     */
+    explicit BasicRingTimerseries(std::size_t capacity);
+
+    /**
+     * \brief Copy constructor.
+     *
+     * This is deleted, since readers and the writer share one ring buffer.
+     */
+    BasicRingTimerseries(const BasicRingTimerseries& orig) = delete;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * This is deleted, since readers and the writer share one ring buffer.
+     */
+    BasicRingTimerseries& operator=(const BasicRingTimerseries& rhs) = delete;
+
+    /**
+     * \brief Frees the ring buffer.
+     */
+    virtual ~BasicRingTimerseries();
+
+    /**
+     * \brief Adds the measurement of a Timer.
+     *
+     * The paused time is left out and a Timer that is reset or still running
+     * is skipped, like in ContiguousTimerseries.
+     * @param timer
+     */
+    BasicRingTimerseries& operator+=(const BasicTimer<Clock>& timer);
+
+    /**
+     * \brief Adds the measurement of a FastTimer.
+     * @param timer
+     */
+    BasicRingTimerseries& operator+=(const BasicFastTimer<Clock>& timer);
+
+    /**
+     * \brief Adds a measurement given by two raw readings of the clock.
+     *
+     * Overwrites the oldest measurement, if the ring buffer is full.
+     * @param startTime
+     * @param stopTime
+     */
+    void append(std::int64_t startTime, std::int64_t stopTime);
+
+    /**
+     * \brief Appends the most recent measurements to the given series.
+     *
+     * Measurements overwritten while they are read are skipped, so fewer than
+     * the requested measurements can be appended. Returns the number of
+     * appended measurements.
+     * @param series The series to append to
+     * @param count The maximum number of measurements
+     */
+    std::size_t snapshot(BasicContiguousTimerseries<Clock>& series,
+        std::size_t count) const;
+
+    /**
+     * \brief Appends all measurements in the ring buffer to the given series.
+     *
+     * See snapshot(BasicContiguousTimerseries&, std::size_t).
+     * @param series
+     */
+    std::size_t snapshot(BasicContiguousTimerseries<Clock>& series) const;
+
+    /**
+     * \brief Returns the number of measurements in the ring buffer.
+     */
+    std::size_t getSize() const;
+
+    /**
+     * \brief Returns the maximum number of measurements.
+     */
+    std::size_t getCapacity() const;
+
+    /**
+     * \brief Returns the number of measurements added since the construction.
+     */
+    std::uint64_t getTotalCount() const;
+
+    /**
+     * \brief Returns the number of measurements that have been overwritten.
+     */
+    std::uint64_t getOverwrittenCount() const;
+
+private:
+    /* The sequence is 2 * index + 1 while the measurement with the index is
+     * written, and 2 * index + 2 after it has been written. */
+    struct Slot {
+        std::atomic<std::uint64_t> mSequence;
+        std::atomic<std::int64_t> mStartTime;
+        std::atomic<std::int64_t> mStopTime;
+    };
+
+    Slot* mSlots;
+    std::size_t mMask;
+    alignas(64) std::atomic<std::uint64_t> mHead;
+};
+
+/**
+ * \brief The default RingTimerseries, holding measurements of the monotonic
+ * clock.
+ */
+typedef BasicRingTimerseries<MonotonicClock> RingTimerseries;
+
+#endif	/* RINGTIMERSERIES_H */
@@ -0,0 +1,207 @@
+/*
+ * File:   RunningStatistic.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 21, 2026, 3:30 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "RunningStatistic.h"
+
+#include <cmath>
+
+/*
+ * Initializes all values to 0.
+ */
+RunningStatistic::RunningStatistic() :
+    mNumberOfElements(0),
+    mMean(0),
+    mMin(0),
+    mMax(0),
+    mSquaredDifferences(0) {
+}
+
+/*
+ * The sum of squared differences is the variance times n - 1.
+ */
+RunningStatistic::RunningStatistic(std::uint64_t numberOfElements,
+        double mean, double variance, double min, double max) :
+    mNumberOfElements(numberOfElements),
+    mMean(mean),
+    mMin(min),
+    mMax(max),
+    mSquaredDifferences(0) {
+    if(numberOfElements > 1) {
+        this->mSquaredDifferences = variance * (numberOfElements - 1);
+    }
+}
+
+/*
+ * Nothing to clean up.
+ */
+RunningStatistic::~RunningStatistic() {
+}
+
+/*
+ * The update of Welford. The difference to the old and to the new mean keeps
+ * the sum of squares accurate, even if the values are large compared to
+ * their spread.
+ */
+void RunningStatistic::add(double value) {
+    if(this->mNumberOfElements == 0) {
+        this->mMin = value;
+        this->mMax = value;
+    } else if(value < this->mMin) {
+        this->mMin = value;
+    } else if(value > this->mMax) {
+        this->mMax = value;
+    }
+
+    ++(this->mNumberOfElements);
+
+    double difference = value - this->mMean;
+    this->mMean += difference / this->mNumberOfElements;
+    this->mSquaredDifferences += difference * (value - this->mMean);
+}
+
+/*
+ * Adds a single value.
+ */
+RunningStatistic& RunningStatistic::operator+=(double value) {
+    this->add(value);
+
+    return *this;
+}
+
+/*
+ * The parallel update of Chan et al. combines the means and sums of squares of
+ * both objects.
+ */
+RunningStatistic& RunningStatistic::operator+=(const RunningStatistic& rhs) {
+    if(rhs.mNumberOfElements == 0) {
+        return *this;
+    }
+
+    if(this->mNumberOfElements == 0) {
+        *this = rhs;
+        return *this;
+    }
+
+    double thisCount = this->mNumberOfElements;
+    double rhsCount = rhs.mNumberOfElements;
+    double count = thisCount + rhsCount;
+    double difference = rhs.mMean - this->mMean;
+
+    this->mMean += difference * rhsCount / count;
+    this->mSquaredDifferences += rhs.mSquaredDifferences
+        + difference * difference * thisCount * rhsCount / count;
+    this->mNumberOfElements += rhs.mNumberOfElements;
+
+    if(rhs.mMin < this->mMin) {
+        this->mMin = rhs.mMin;
+    }
+
+    if(rhs.mMax > this->mMax) {
+        this->mMax = rhs.mMax;
+    }
+
+    return *this;
+}
+
+/*
+ * Merges a copy of this object with rhs.
+ */
+RunningStatistic RunningStatistic::operator+(
+        const RunningStatistic& rhs) const {
+    RunningStatistic sum(*this);
+
+    sum += rhs;
+
+    return sum;
+}
+
+/*
+ * Resets all values to 0.
+ */
+void RunningStatistic::clear() {
+    this->mNumberOfElements = 0;
+    this->mMean = 0;
+    this->mMin = 0;
+    this->mMax = 0;
+    this->mSquaredDifferences = 0;
+}
+
+/*
+ * This returns the number of values.
+ */
+std::uint64_t RunningStatistic::getNumberOfElements() const {
+    return this->mNumberOfElements;
+}
+
+/*
+ * This returns the minimum value.
+ */
+double RunningStatistic::getMin() const {
+    return this->mMin;
+}
+
+/*
+ * This returns the maximum value.
+ */
+double RunningStatistic::getMax() const {
+    return this->mMax;
+}
+
+/*
+ * This returns the mean value.
+ */
+double RunningStatistic::getMean() const {
+    return this->mMean;
+}
+
+/*
+ * Divides by n - 1 like Statistic. A single value has no variance.
+ */
+double RunningStatistic::getVariance() const {
+    if(this->mNumberOfElements <= 1) {
+        return 0.0;
+    }
+
+    return this->mSquaredDifferences / (this->mNumberOfElements - 1);
+}
+
+/*
+ * The standard deviation is the root of the variance.
+ */
+double RunningStatistic::getStddev() const {
+    return std::sqrt(this->getVariance());
+}
@@ -0,0 +1,175 @@
+/*
+ * File:   RunningStatistic.h
+ * Author: Nils Döring
+ *
+ * Created on October 21, 2026, 3:30 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef RUNNINGSTATISTIC_H
+#define	RUNNINGSTATISTIC_H
+
+#include <cstdint>
+
+/**
+ * \brief This class accumulates statistical values one value at a time.
+ *
+ * Unlike Statistic, a RunningStatistic does not store the values. It keeps
+ * the number of values, their minimum, maximum, mean and the sum of squared
+ * differences from the mean, which are updated in O(1) per value with the
+ * algorithm of Welford. Percentiles are not available therefore.
+ *
+ * Two RunningStatistic objects can be merged in O(1) with the formula of Chan
+ * et al. This allows e.g. one object per thread or per second, which are
+ * merged for reporting:
+ * \code
+ * RunningStatistic second;
+ * ...
+ * second += timer.getTimeInMicroSeconds();
+ * ...
+ * total += second;
+ * second.clear();
+ * \endcode
+ *
+ * \attention This class is not thread-safe.
+ */
+class RunningStatistic {
+public:
+    /**
+     * \brief Creates an empty object.
+     */
+    RunningStatistic();
+
+    /**
+     * \brief Creates an object from known statistical values.
+     *
+     * This allows to merge the values of a Statistic.
+     * @param numberOfElements
+     * @param mean
+     * @param variance The sample variance, i.e. divided by n - 1
+     * @param min
+     * @param max
+     */
+    RunningStatistic(std::uint64_t numberOfElements, double mean,
+        double variance, double min, double max);
+
+    /**
+     * \brief Creates an object from a range of values.
+     * @param first
+     * @param last
+     */
+    template<class InputIterator>
+    RunningStatistic(InputIterator first, InputIterator last) :
+            RunningStatistic() {
+        for(; first != last; ++first) {
+            this->add(*first);
+        }
+    }
+
+    /**
+     * \brief Standard destructor.
+     */
+    virtual ~RunningStatistic();
+
+    /**
+     * \brief Adds a value.
+     * @param value
+     */
+    void add(double value);
+
+    /**
+     * \brief Adds a value, see add().
+     * @param value
+     */
+    RunningStatistic& operator+=(double value);
+
+    /**
+     * \brief Merges the values of rhs into this object.
+     *
+     * The result is the same as if all values of rhs were added to this
+     * object.
+     * @param rhs
+     */
+    RunningStatistic& operator+=(const RunningStatistic& rhs);
+
+    /**
+     * \brief Returns the merge of both objects.
+     * @param rhs
+     */
+    RunningStatistic operator+(const RunningStatistic& rhs) const;
+
+    /**
+     * \brief Removes all values.
+     */
+    void clear();
+
+    /**
+     * \brief Returns the number of values.
+     */
+    std::uint64_t getNumberOfElements() const;
+
+    /**
+     * \brief Returns the minimum value.
+     */
+    double getMin() const;
+
+    /**
+     * \brief Returns the maximum value.
+     */
+    double getMax() const;
+
+    /**
+     * \brief Returns the mean value.
+     */
+    double getMean() const;
+
+    /**
+     * \brief Returns the variance of the values.
+     *
+     * Like Statistic, this is the sample variance, divided by n - 1.
+     */
+    double getVariance() const;
+
+    /**
+     * \brief Returns the standard deviation of the values.
+     */
+    double getStddev() const;
+
+private:
+    std::uint64_t mNumberOfElements;
+    double mMean, mMin, mMax;
+
+    /* the sum of squared differences from the mean */
+    double mSquaredDifferences;
+};
+
+#endif	/* RUNNINGSTATISTIC_H */
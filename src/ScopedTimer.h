@@ -0,0 +1,198 @@
+/*
+ * File:   ScopedTimer.h
+ * Author: Nils Döring
+ *
+ * Created on October 17, 2026, 9:20 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SCOPEDTIMER_H
+#define	SCOPEDTIMER_H
+
+#include <cstdint>
+#include <new>
+#include "Timestamp.h"
+#include "Clock.h"
+#include "Calibration.h"
+#include "Timer.h"
+#include "Timerseries.h"
+
+/**
+ * \brief This class measures the lifetime of a scope.
+ *
+ * A ScopedTimer starts when it is constructed and stops when it is destroyed,
+ * also if the scope is left by an exception. The duration is then recorded into
+ * the sink given to the constructor:
+ *
+ * - a Timer, which is overwritten with a stopped Timer. Use a preallocated
+ *   Timer to record without any allocation.
+ * - a Timerseries, to which a new stopped Timer is appended. The Timer is
+ *   created after the stop reading, so this is not part of the duration.
+ * - a callback, which gets the duration and a user supplied pointer. This does
+ *   not allocate either.
+ *
+ * \code
+ * void query(Timerseries& series) {
+ *     ScopedTimer timer(series);
+ *     ...
+ * }
+ * \endcode
+ *
+ * \attention This class is \b NOT reentrant and \b NOT thread-safe.
+ * \tparam Clock One of the clock policies defined in Clock.h.
+ */
+template<class Clock>
+class BasicScopedTimer {
+public:
+    /**
+     * \brief The type of functions receiving the duration.
+     *
+     * The context is the pointer given to the constructor.
+     */
+    typedef void (*Callback)(const Timestamp& duration, void* context);
+
+    /**
+     * \brief Starts a timer recording into the given Timer.
+     * @param slot
+     */
+    explicit BasicScopedTimer(BasicTimer<Clock>& slot) :
+        mSink(TIMER_SINK),
+        mTimer(&slot),
+        mSeries(nullptr),
+        mCallback(nullptr),
+        mContext(nullptr),
+        mStartTime(Clock::read()) {
+    }
+
+    /**
+     * \brief Starts a timer appending to the given Timerseries.
+     * @param series
+     */
+    explicit BasicScopedTimer(BasicTimerseries<Clock>& series) :
+        mSink(SERIES_SINK),
+        mTimer(nullptr),
+        mSeries(&series),
+        mCallback(nullptr),
+        mContext(nullptr),
+        mStartTime(Clock::read()) {
+    }
+
+    /**
+     * \brief Starts a timer passing the duration to the given function.
+     * @param callback
+     * @param context
+     */
+    BasicScopedTimer(Callback callback, void* context) :
+        mSink(CALLBACK_SINK),
+        mTimer(nullptr),
+        mSeries(nullptr),
+        mCallback(callback),
+        mContext(context),
+        mStartTime(Clock::read()) {
+    }
+
+    /**
+     * \brief Stops the timer and records the duration.
+     *
+     * Nothing is recorded if dismiss() has been called.
+     */
+    ~BasicScopedTimer() {
+        std::int64_t stopTime = Clock::read();
+
+        switch(this->mSink) {
+            case TIMER_SINK:
+                *(this->mTimer) = BasicTimer<Clock>(this->mStartTime, stopTime);
+                break;
+            case SERIES_SINK:
+                // a destructor must not throw, the measurement is lost instead
+                try {
+                    this->mSeries->newTimer(
+                        BasicTimer<Clock>(this->mStartTime, stopTime));
+                } catch(const std::bad_alloc&) {
+                }
+                break;
+            case CALLBACK_SINK:
+                this->mCallback(this->toTimestamp(stopTime), this->mContext);
+                break;
+            case NO_SINK:
+                break;
+        }
+    }
+
+    /**
+     * \brief Returns the time elapsed since the construction.
+     */
+    Timestamp getTime() const {
+        return this->toTimestamp(Clock::read());
+    }
+
+    /**
+     * \brief Prevents the duration from being recorded.
+     */
+    void dismiss() {
+        this->mSink = NO_SINK;
+    }
+
+    /**
+     * This is deleted, since only one object may record the duration.
+     * @param orig
+     */
+    BasicScopedTimer(const BasicScopedTimer& orig) = delete;
+
+    /**
+     * This is deleted, since only one object may record the duration.
+     * @param rhs
+     */
+    BasicScopedTimer& operator=(const BasicScopedTimer& rhs) = delete;
+
+private:
+    enum Sink { NO_SINK, TIMER_SINK, SERIES_SINK, CALLBACK_SINK };
+
+    Timestamp toTimestamp(const std::int64_t stopTime) const {
+        std::int64_t ticks =
+            Calibration<Clock>::correct(stopTime - this->mStartTime);
+
+        return Clock::toTimestamp(ticks);
+    }
+
+    Sink mSink;
+    BasicTimer<Clock>* mTimer;
+    BasicTimerseries<Clock>* mSeries;
+    Callback mCallback;
+    void* mContext;
+    std::int64_t mStartTime;
+};
+
+/**
+ * \brief The default ScopedTimer, measuring with the monotonic clock.
+ */
+typedef BasicScopedTimer<MonotonicClock> ScopedTimer;
+
+#endif	/* SCOPEDTIMER_H */
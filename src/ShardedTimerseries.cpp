@@ -0,0 +1,424 @@
+/*
+ * File:   ShardedTimerseries.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 19, 2026, 1:50 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "ShardedTimerseries.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+/* every series gets a new id, so a cached shard of a destroyed series never
+ * matches a series created later on the same slot */
+std::atomic<std::uint64_t> sNextSeriesId(1);
+
+/* the shards of this thread, indexed by the slot of their series, an id of 0
+ * is empty */
+struct ShardCacheEntry {
+    std::uint64_t mSeriesId;
+    void* mShard;
+};
+
+thread_local std::vector<ShardCacheEntry> sShardCache;
+
+/* the slots of destroyed series are reused, so the cache of a thread is only
+ * as large as the number of series existing at the same time */
+struct SlotPool {
+    std::mutex mMutex;
+    std::vector<std::size_t> mFree;
+    std::size_t mNext;
+};
+
+/*
+ * The pool is created on first use, so series may be created during static
+ * initialisation.
+ */
+SlotPool& getSlotPool() {
+    static SlotPool pool;
+
+    return pool;
+}
+
+std::size_t acquireSlot() {
+    SlotPool& pool = getSlotPool();
+    std::lock_guard<std::mutex> lock(pool.mMutex);
+
+    if(pool.mFree.empty()) {
+        return pool.mNext++;
+    }
+
+    std::size_t slot = pool.mFree.back();
+    pool.mFree.pop_back();
+
+    return slot;
+}
+
+void releaseSlot(std::size_t slot) {
+    SlotPool& pool = getSlotPool();
+    std::lock_guard<std::mutex> lock(pool.mMutex);
+
+    pool.mFree.push_back(slot);
+}
+
+}
+
+template<class Clock>
+const std::size_t BasicShardedTimerseries<Clock>::CHUNK_SIZE;
+
+/*
+ * Create a series without shards. Each thread registers its shard on its
+ * first measurement.
+ */
+template<class Clock>
+BasicShardedTimerseries<Clock>::BasicShardedTimerseries() :
+    mId(sNextSeriesId.fetch_add(1, std::memory_order_relaxed)),
+    mSlot(acquireSlot()),
+    mMutex(),
+    mShards(){
+}
+
+/*
+ * Free all shards with their chunks. The slot is reused by another series,
+ * whose new id does not match the cached shards of this one.
+ */
+template<class Clock>
+BasicShardedTimerseries<Clock>::~BasicShardedTimerseries() {
+    for(Shard* shard: this->mShards) {
+        deleteShard(shard);
+    }
+
+    releaseSlot(this->mSlot);
+}
+
+/*
+ * The stop reading is the start plus the elapsed ticks, so the paused time is
+ * left out. Timers that are reset or still running are skipped.
+ */
+template<class Clock>
+BasicShardedTimerseries<Clock>&
+BasicShardedTimerseries<Clock>::operator+=(const BasicTimer<Clock>& timer) {
+    if(timer.isRunning() or timer.isReset()) {
+        return *this;
+    }
+
+    std::int64_t startTime = timer.getStartTicks();
+
+    this->append(startTime, startTime + timer.getElapsedTicks());
+
+    return *this;
+}
+
+/*
+ * Copy both readings of the FastTimer.
+ */
+template<class Clock>
+BasicShardedTimerseries<Clock>&
+BasicShardedTimerseries<Clock>::operator+=(const BasicFastTimer<Clock>& timer) {
+    this->append(timer.getStartTime(), timer.getStopTime());
+
+    return *this;
+}
+
+/*
+ * Only the owning thread writes to its shard. A full chunk is followed by a
+ * new one, which is linked before any measurement in it is published. The
+ * count is published last, so readers see complete measurements only.
+ */
+template<class Clock>
+void BasicShardedTimerseries<Clock>::append(std::int64_t startTime,
+        std::int64_t stopTime) {
+    Shard* shard = this->getShard();
+
+    if(shard->mLastCount == CHUNK_SIZE) {
+        Chunk* chunk = newChunk();
+
+        shard->mLast->mNext.store(chunk, std::memory_order_release);
+        shard->mLast = chunk;
+        shard->mLastCount = 0;
+    }
+
+    shard->mLast->mStartTimes[shard->mLastCount] = startTime;
+    shard->mLast->mStopTimes[shard->mLastCount] = stopTime;
+    ++(shard->mLastCount);
+
+    shard->mCount.store(shard->mCount.load(std::memory_order_relaxed) + 1,
+        std::memory_order_release);
+}
+
+/*
+ * Copy the published measurements of every shard. The lock only keeps the
+ * list of shards from changing, the threads keep recording meanwhile. The
+ * counts are loaded first, so the series is grown only once.
+ */
+template<class Clock>
+std::size_t BasicShardedTimerseries<Clock>::snapshot(
+        BasicContiguousTimerseries<Clock>& series) const {
+    std::lock_guard<std::mutex> lock(this->mMutex);
+    std::vector<std::size_t> counts(this->mShards.size());
+    std::size_t total = 0;
+
+    for(std::size_t i = 0; i < this->mShards.size(); ++i) {
+        counts[i] = this->mShards[i]->mCount.load(std::memory_order_acquire);
+        total += counts[i];
+    }
+
+    series.reserve(series.getSize() + total);
+
+    for(std::size_t i = 0; i < this->mShards.size(); ++i) {
+        std::size_t count = counts[i];
+        const Chunk* chunk = this->mShards[i]->mFirst;
+
+        while(count > 0) {
+            std::size_t inChunk = count < CHUNK_SIZE ? count : CHUNK_SIZE;
+
+            for(std::size_t j = 0; j < inChunk; ++j) {
+                series.append(chunk->mStartTimes[j], chunk->mStopTimes[j]);
+            }
+
+            count -= inChunk;
+
+            if(count > 0) {
+                chunk = chunk->mNext.load(std::memory_order_acquire);
+            }
+        }
+    }
+
+    return total;
+}
+
+/*
+ * Keep the shards, since the threads have cached them, and keep their first
+ * chunks for the next measurements.
+ */
+template<class Clock>
+void BasicShardedTimerseries<Clock>::clear() {
+    std::lock_guard<std::mutex> lock(this->mMutex);
+
+    for(Shard* shard: this->mShards) {
+        Chunk* chunk = shard->mFirst->mNext.load(std::memory_order_relaxed);
+
+        while(chunk != nullptr) {
+            Chunk* next = chunk->mNext.load(std::memory_order_relaxed);
+            delete chunk;
+            chunk = next;
+        }
+
+        shard->mFirst->mNext.store(nullptr, std::memory_order_relaxed);
+        shard->mLast = shard->mFirst;
+        shard->mLastCount = 0;
+        shard->mCount.store(0, std::memory_order_release);
+    }
+}
+
+/*
+ * Sum up the published counts.
+ */
+template<class Clock>
+int BasicShardedTimerseries<Clock>::getSize() const {
+    std::lock_guard<std::mutex> lock(this->mMutex);
+    std::size_t size = 0;
+
+    for(const Shard* shard: this->mShards) {
+        size += shard->mCount.load(std::memory_order_acquire);
+    }
+
+    return static_cast<int>(size);
+}
+
+/*
+ * Returns the number of registered shards.
+ */
+template<class Clock>
+int BasicShardedTimerseries<Clock>::getShardCount() const {
+    std::lock_guard<std::mutex> lock(this->mMutex);
+
+    return static_cast<int>(this->mShards.size());
+}
+
+/*
+ * Merge all shards and return the durations.
+ */
+template<class Clock>
+std::list<Timestamp>* BasicShardedTimerseries<Clock>::getTimes() const {
+    BasicContiguousTimerseries<Clock> series;
+    this->snapshot(series);
+
+    return series.getTimes();
+}
+
+/*
+ * Merge all shards and return the durations in seconds.
+ */
+template<class Clock>
+std::list<double>* BasicShardedTimerseries<Clock>::getTimesInSeconds() const {
+    BasicContiguousTimerseries<Clock> series;
+    this->snapshot(series);
+
+    return series.getTimesInSeconds();
+}
+
+/*
+ * Merge all shards and return the durations in milliseconds.
+ */
+template<class Clock>
+std::list<double>*
+BasicShardedTimerseries<Clock>::getTimesInMilliSeconds() const {
+    BasicContiguousTimerseries<Clock> series;
+    this->snapshot(series);
+
+    return series.getTimesInMilliSeconds();
+}
+
+/*
+ * Merge all shards and return the durations in microseconds.
+ */
+template<class Clock>
+std::list<double>*
+BasicShardedTimerseries<Clock>::getTimesInMicroSeconds() const {
+    BasicContiguousTimerseries<Clock> series;
+    this->snapshot(series);
+
+    return series.getTimesInMicroSeconds();
+}
+
+/*
+ * Merge all shards and return the durations in nanoseconds.
+ */
+template<class Clock>
+std::list<double>*
+BasicShardedTimerseries<Clock>::getTimesInNanoSeconds() const {
+    BasicContiguousTimerseries<Clock> series;
+    this->snapshot(series);
+
+    return series.getTimesInNanoSeconds();
+}
+
+/*
+ * The thread-local cache is indexed by the slot of this series, so finding the
+ * shard is an array access. Only the first measurement of a thread takes the
+ * lock.
+ */
+template<class Clock>
+typename BasicShardedTimerseries<Clock>::Shard*
+BasicShardedTimerseries<Clock>::getShard() {
+    if(this->mSlot < sShardCache.size()
+            and sShardCache[this->mSlot].mSeriesId == this->mId) {
+        return static_cast<Shard*>(sShardCache[this->mSlot].mShard);
+    }
+
+    Shard* shard = this->registerShard();
+
+    if(this->mSlot >= sShardCache.size()) {
+        sShardCache.resize(this->mSlot + 1, ShardCacheEntry{0, nullptr});
+    }
+
+    sShardCache[this->mSlot].mSeriesId = this->mId;
+    sShardCache[this->mSlot].mShard = shard;
+
+    return shard;
+}
+
+/*
+ * Find the shard of the calling thread or create it. A new thread may get the
+ * id of an exited one and continues its shard, which is safe since the shard
+ * has only one writer at a time.
+ */
+template<class Clock>
+typename BasicShardedTimerseries<Clock>::Shard*
+BasicShardedTimerseries<Clock>::registerShard() {
+    std::lock_guard<std::mutex> lock(this->mMutex);
+    std::thread::id owner = std::this_thread::get_id();
+
+    for(Shard* shard: this->mShards) {
+        if(shard->mOwner == owner) {
+            return shard;
+        }
+    }
+
+    void* memory = nullptr;
+
+    if(posix_memalign(&memory, alignof(Shard), sizeof(Shard)) != 0) {
+        throw std::bad_alloc();
+    }
+
+    Shard* shard = new (memory) Shard();
+    shard->mOwner = owner;
+    shard->mFirst = newChunk();
+    shard->mLast = shard->mFirst;
+    shard->mLastCount = 0;
+    shard->mCount.store(0, std::memory_order_relaxed);
+
+    this->mShards.push_back(shard);
+
+    return shard;
+}
+
+/*
+ * Create an empty chunk without a successor.
+ */
+template<class Clock>
+typename BasicShardedTimerseries<Clock>::Chunk*
+BasicShardedTimerseries<Clock>::newChunk() {
+    Chunk* chunk = new Chunk();
+    chunk->mNext.store(nullptr, std::memory_order_relaxed);
+
+    return chunk;
+}
+
+/*
+ * Free all chunks and the aligned memory of the shard.
+ */
+template<class Clock>
+void BasicShardedTimerseries<Clock>::deleteShard(Shard* shard) {
+    Chunk* chunk = shard->mFirst;
+
+    while(chunk != nullptr) {
+        Chunk* next = chunk->mNext.load(std::memory_order_relaxed);
+        delete chunk;
+        chunk = next;
+    }
+
+    shard->~Shard();
+    std::free(shard);
+}
+
+template class BasicShardedTimerseries<RealtimeClock>;
+template class BasicShardedTimerseries<MonotonicClock>;
+template class BasicShardedTimerseries<MonotonicRawClock>;
+template class BasicShardedTimerseries<BoottimeClock>;
+template class BasicShardedTimerseries<ProcessCpuClock>;
+template class BasicShardedTimerseries<ThreadCpuClock>;
+template class BasicShardedTimerseries<TscClock>;
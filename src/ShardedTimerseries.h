@@ -0,0 +1,218 @@
+/*
+ * File:   ShardedTimerseries.h
+ * Author: Nils Döring
+ *
+ * Created on October 19, 2026, 1:50 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef SHARDEDTIMERSERIES_H
+#define	SHARDEDTIMERSERIES_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Timestamp.h"
+#include "Clock.h"
+#include "Timer.h"
+#include "FastTimer.h"
+#include "ContiguousTimerseries.h"
+
+/**
+ * \brief This class records measurements of many threads without locking.
+ *
+ * Every thread recording into a ShardedTimerseries gets its own shard, a
+ * buffer aligned to a cache line. Recording appends to the shard of the calling
+ * thread without any synchronisation except for publishing the new number of
+ * measurements. Only the first measurement of a thread takes a lock, to
+ * register its shard.
+ *
+ * Readers merge all shards on demand with snapshot() or the getTimes*()
+ * methods. They see every measurement published before, while the threads keep
+ * recording. The shards belong to the series, so the measurements of a thread
+ * are kept after the thread has exited.
+ *
+ * \attention Measurements are recorded and merged thread-safely. clear() and
+ * the destructor must not run while other threads record.
+ * \tparam Clock One of the clock policies defined in Clock.h.
+ */
+template<class Clock>
+class BasicShardedTimerseries {
+public:
+    /**
+     * \brief The number of measurements stored in each chunk of a shard.
+     */
+    static const std::size_t CHUNK_SIZE = 1024;
+
+    /**
+     * \brief Default constructor.
+     *
+     * Creates a series without any shard.
+     */
+    BasicShardedTimerseries();
+
+    /**
+     * \brief Copy constructor.
+     *
+     * This is deleted, since the threads cache their shards of this series.
+     */
+    BasicShardedTimerseries(const BasicShardedTimerseries& orig) = delete;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * This is deleted, since the threads cache their shards of this series.
+     */
+    BasicShardedTimerseries& operator=(
+        const BasicShardedTimerseries& rhs) = delete;
+
+    /**
+     * \brief Frees all shards.
+     */
+    virtual ~BasicShardedTimerseries();
+
+    /**
+     * \brief Records the measurement of a Timer in the shard of the calling
+     * thread.
+     *
+     * The paused time is left out and a Timer that is reset or still running
+     * is skipped, like in ContiguousTimerseries.
+     * @param timer
+     */
+    BasicShardedTimerseries& operator+=(const BasicTimer<Clock>& timer);
+
+    /**
+     * \brief Records the measurement of a FastTimer in the shard of the
+     * calling thread.
+     * @param timer
+     */
+    BasicShardedTimerseries& operator+=(const BasicFastTimer<Clock>& timer);
+
+    /**
+     * \brief Records a measurement given by two raw readings of the clock in
+     * the shard of the calling thread.
+     * @param startTime
+     * @param stopTime
+     */
+    void append(std::int64_t startTime, std::int64_t stopTime);
+
+    /**
+     * \brief Appends the measurements of all shards to the given series.
+     *
+     * The measurements of each thread keep their order. Returns the number of
+     * appended measurements.
+     * @param series
+     */
+    std::size_t snapshot(BasicContiguousTimerseries<Clock>& series) const;
+
+    /**
+     * \brief Removes all measurements.
+     *
+     * The shards are kept, but all chunks except the first are freed.
+     *
+     * \attention No thread may record while the series is cleared.
+     */
+    void clear();
+
+    /**
+     * \brief Returns the number of measurements of all shards.
+     */
+    int getSize() const;
+
+    /**
+     * \brief Returns the number of shards, i.e. of the threads that recorded.
+     */
+    int getShardCount() const;
+
+    /**
+     * \brief Get the Timestamps with the durations of all measurements.
+     */
+    std::list<Timestamp>* getTimes() const;
+
+    /**
+     * \brief Returns the durations of all measurements in seconds.
+     */
+    std::list<double>* getTimesInSeconds() const;
+
+    /**
+     * \brief Returns the durations of all measurements in milliseconds.
+     */
+    std::list<double>* getTimesInMilliSeconds() const;
+
+    /**
+     * \brief Returns the durations of all measurements in microseconds.
+     */
+    std::list<double>* getTimesInMicroSeconds() const;
+
+    /**
+     * \brief Returns the durations of all measurements in nanoseconds.
+     */
+    std::list<double>* getTimesInNanoSeconds() const;
+
+private:
+    struct Chunk {
+        std::int64_t mStartTimes[CHUNK_SIZE];
+        std::int64_t mStopTimes[CHUNK_SIZE];
+        std::atomic<Chunk*> mNext;
+    };
+
+    /* Everything but mCount is only accessed by the owning thread, and by
+     * clear() and the destructor. mCount publishes the measurements. */
+    struct alignas(64) Shard {
+        std::thread::id mOwner;
+        Chunk* mFirst;
+        Chunk* mLast;
+        std::size_t mLastCount;
+        std::atomic<std::size_t> mCount;
+    };
+
+    Shard* getShard();
+    Shard* registerShard();
+    static Chunk* newChunk();
+    static void deleteShard(Shard* shard);
+
+    std::uint64_t mId;
+    std::size_t mSlot;
+    mutable std::mutex mMutex;
+    std::vector<Shard*> mShards;
+};
+
+/**
+ * \brief The default ShardedTimerseries, holding measurements of the monotonic
+ * clock.
+ */
+typedef BasicShardedTimerseries<MonotonicClock> ShardedTimerseries;
+
+#endif	/* SHARDEDTIMERSERIES_H */
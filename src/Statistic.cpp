@@ -35,130 +35,164 @@
 
 #include "Statistic.h"
 
+#include <algorithm>
+#include <utility>
+
 /*
  * This initializes an empty object. No computation is done here.
  */
-Statistic::Statistic() {
-    this->mSeries = nullptr;
-    this->mSortedSeries = nullptr;
+Statistic::Statistic() : mSeries(), mSortedSeries() {
     this->mMean = 0;
     this->mMin = 0;
     this->mMax = 0;
     this->mStddev = 0;
     this->mVariance = 0;
     this->mNumberOfElements = 0;
+    this->mPopulationSize = 0;
     this->mMedian = 0;
     this->mFirstQuartile = 0;
     this->mThirdQuartile = 0;
 }
 
 /*
- * This creates an empty object with the standard constructor, copies the
- * elements of the list of values to this objects series and calculates the
+ * This creates an empty object with the standard constructor, takes the
+ * elements of the list of values over by swapping the lists and calculates the
  * statistical values. This could take a long time.
  */
 Statistic::Statistic(std::list<double>* series) : Statistic() {
-    this->mSeries = series;
+    this->mSeries.swap(*series);
+    delete series;
 
     this->calculateStatistics();
 }
 
 /*
- * This also creates a new empty object and copies all values from the original
- * object to this. This is a deep copy, so the objects remain independent. If
- * the original object has already sorted the series, this object do not have to
- * re-sort it.
+ * Moves the values into the series of this object and calculates the
+ * statistical values.
  */
-Statistic::Statistic(const Statistic& orig) : Statistic() {
-    this->mSeries = new std::list<double>( *(orig.mSeries) );
-    this->mSortedSeries = new std::list<double>( *(orig.mSortedSeries) );
+Statistic::Statistic(std::list<double>&& series) : Statistic() {
+    this->mSeries = std::move(series);
 
     this->calculateStatistics();
 }
 
 /*
- * This destructor deletes all lists in this object. If the list is still used
- * outside of this object, this can be a problem. Please ensure, you don't use
- * these series outside of the object.
+ * This is a deep copy of the values and the calculated statistical values, so
+ * the objects remain independent and nothing has to be calculated again.
  */
-Statistic::~Statistic() {
-    /*delete all values and set the pointer to nullptr*/
-    if(this->mSeries != nullptr) {
-        delete this->mSeries;
-        this->mSeries = nullptr;
-    }
+Statistic::Statistic(const Statistic& orig) = default;
 
-    /*delete all values and set the pointer to nullptr*/
-    if(this->mSortedSeries != nullptr){
-        delete this->mSortedSeries;
-        this->mSortedSeries = nullptr;
-    }
+/*
+ * The lists are moved, the statistical values copied. orig is left empty, see
+ * the move assignment.
+ */
+Statistic::Statistic(Statistic&& orig) : Statistic() {
+    *this = std::move(orig);
+}
+
+/*
+ * The lists free their values themselves.
+ */
+Statistic::~Statistic() {
 }
 
 /*
- * This calculates an arbitrary percentile from the sorted list of values. This
- * method does not change anything outside.
+ * This calculates an arbitrary percentile from the sorted array of values. The
+ * ranks of the methods are 1-based, the array is 0-based. This method does not
+ * change anything outside.
  */
-double Statistic::getPercentile(int percentile,
-        const std::list<double>* sortedValues) const {
+double Statistic::getPercentile(double percentile,
+        PercentileMethod method) const {
+    std::size_t size = this->mSortedSeries.size();
 
-    if(this->mSeries->size() <= 1){  // this series is to small
+    if(size == 0 or percentile > 100 or percentile < 0) {  // no result
         return 0;
     }
 
-    double position;
-    bool even;
+    const double* values = this->mSortedSeries.data();
+    double rank, position;
 
-    if(percentile > 100 or percentile < 0) {  // wrong parameter
-        return 0;
-    } else {
-        /*calculate the position in the list*/
-        double pos = percentile / 100.0 * (this->mNumberOfElements);
-
-        /*check if pos points exactly to an element*/
-        if( modf(pos, &position) == 0.0 ){
-            even = true;
-        } else {
-            even = false;
+    switch(method) {
+    case NEAREST_RANK:
+        rank = std::ceil(percentile / 100.0 * size);
+
+        return values[rank < 1 ? 0 : static_cast<std::size_t>(rank) - 1];
+
+    case AVERAGED:
+        /*check if the position points exactly between two elements*/
+        if(std::modf(percentile / 100.0 * size, &position) == 0.0) {
+            std::size_t lower = position < 1 ? 0
+                : static_cast<std::size_t>(position) - 1;
+            std::size_t upper = position < size
+                ? static_cast<std::size_t>(position) : size - 1;
+
+            return values[lower] / 2.0 + values[upper] / 2.0;
         }
-    }
 
-    std::list<double>::const_iterator valIter = sortedValues->cbegin();
-    double percentileValue = 0;
+        return values[static_cast<std::size_t>(position)];
+
+    case LINEAR:
+    default:
+        double fraction = std::modf((size - 1) * percentile / 100.0, &position);
+        std::size_t lower = static_cast<std::size_t>(position);
 
-    /*move to the right element*/
-    for(int i = 0; i < position - 1; ++i){
-            ++valIter;
+        if(lower + 1 >= size) {
+            return values[size - 1];
+        }
+
+        return values[lower] + fraction * (values[lower + 1] - values[lower]);
     }
+}
 
-    if(even){  // percentile lies between to elements
-        /*calculate mean of these to elements*/
-        percentileValue += *valIter / 2.0;
-        ++valIter;
-        percentileValue += *valIter / 2.0;
-    } else {  // use this exact element
-        ++valIter;
-        percentileValue = *valIter;
+/*
+ * The values are sorted already, so each percentile is a lookup.
+ */
+void Statistic::getPercentiles(const double* percentiles, double* results,
+        std::size_t count, PercentileMethod method) const {
+    for(std::size_t i = 0; i < count; ++i) {
+        results[i] = this->getPercentile(percentiles[i], method);
     }
+}
 
-    return percentileValue;
+/*
+ * The quartiles are calculated with the averaging method.
+ */
+void Statistic::calculateQuartiles() {
+    this->mFirstQuartile = this->getPercentile(25, AVERAGED);
+    this->mMedian = this->getPercentile(50, AVERAGED);
+    this->mThirdQuartile = this->getPercentile(75, AVERAGED);
 }
 
 /*
  * This method does the heavy calculation and sorting. Herein all statistical
- * values are calculated. Sorting is only done, if the pointer to the sorted
- * list is set to nullptr.
+ * values are calculated. The sorted list is a sorted copy of the values.
  */
 void Statistic::calculateStatistics() {
     /*set the number to the size*/
-    this->mNumberOfElements = this->mSeries->size();
+    this->mNumberOfElements = this->mSeries.size();
+
+    /*the sums start from zero, previous values must not be added again*/
+    this->mMean = 0;
+    this->mVariance = 0;
+
+    /*an empty series has no statistical values*/
+    if(this->mSeries.empty()) {
+        this->mMin = 0;
+        this->mMax = 0;
+        this->mStddev = 0;
+        this->mMedian = 0;
+        this->mFirstQuartile = 0;
+        this->mThirdQuartile = 0;
+        this->mSortedSeries.clear();
+        return;
+    }
 
     /*initialize the minimum and maximum values to the first*/
-    this->mMin = *(this->mSeries->begin());
+    this->mMin = this->mSeries.front();
     this->mMax = this->mMin;
 
     /*go through all elements*/
-    for(double element: *(this->mSeries)){
+    for(double element: this->mSeries){
         /*set mMin or mMax to the current if they need to change*/
         if(element > this->mMax){
             this->mMax = element;
@@ -174,7 +208,7 @@ void Statistic::calculateStatistics() {
     this->mMean /= this->mNumberOfElements;
 
     /*calculate the variance*/
-    for(double element: *(this->mSeries)){
+    for(double element: this->mSeries){
         double difference = element - this->mMean;
 
         /*sum all squares of differences*/
@@ -192,16 +226,12 @@ void Statistic::calculateStatistics() {
     /*calculate standard deviation from variance*/
     this->mStddev = sqrt(this->mVariance);
 
-    /*if there is no sorted list, copy and sort it*/
-    if(this->mSortedSeries == nullptr){
-        this->mSortedSeries = new std::list<double>(*(this->mSeries));
-        this->mSortedSeries->sort();
-    }
+    /*copy and sort the values*/
+    this->mSortedSeries.assign(this->mSeries.begin(), this->mSeries.end());
+    std::sort(this->mSortedSeries.begin(), this->mSortedSeries.end());
 
     /*calculate the percentiles 25, 50 and 75*/
-    this->mFirstQuartile = this->getPercentile(25, this->mSortedSeries);
-    this->mMedian = this->getPercentile(50, this->mSortedSeries);
-    this->mThirdQuartile = this->getPercentile(75, this->mSortedSeries);
+    this->calculateQuartiles();
 }
 
 /*
@@ -216,8 +246,8 @@ std::list<double>* Statistic::calculateSlidingMean(int meanWidth) const {
 
     double currentMean = 0;
     /*create to boundaries to calculate the mean within*/
-    std::list<double>::iterator upperValueIter = this->mSeries->begin();
-    std::list<double>::iterator lowerValueIter = this->mSeries->begin();
+    std::list<double>::const_iterator upperValueIter = this->mSeries.begin();
+    std::list<double>::const_iterator lowerValueIter = this->mSeries.begin();
 
     /*go through all elements*/
     for(int i = 0; i < this->mNumberOfElements; ++i){
@@ -271,6 +301,13 @@ double Statistic::getMean() const{
     return this->mMean;
 }
 
+/*
+ * The sorted copy is kept for the percentiles anyway.
+ */
+const std::vector<double>& Statistic::getSortedSeries() const {
+    return this->mSortedSeries;
+}
+
 /*
  * This returns the number of values.
  */
@@ -278,6 +315,34 @@ int Statistic::getNumberOfElements() const {
     return this->mNumberOfElements;
 }
 
+/*
+ * A population is never smaller than the values of its sample.
+ */
+std::uint64_t Statistic::getPopulationSize() const {
+    std::uint64_t numberOfElements = this->mNumberOfElements;
+
+    if(this->mPopulationSize > numberOfElements) {
+        return this->mPopulationSize;
+    }
+
+    return numberOfElements;
+}
+
+/*
+ * Creates a RunningStatistic from the calculated values.
+ */
+RunningStatistic Statistic::getRunningStatistic() const {
+    return RunningStatistic(this->mNumberOfElements, this->mMean,
+        this->mVariance, this->mMin, this->mMax);
+}
+
+/*
+ * This sets the size of the population.
+ */
+void Statistic::setPopulationSize(std::uint64_t populationSize) {
+    this->mPopulationSize = populationSize;
+}
+
 /*
  * This returns the standard deviation of the values.
  */
@@ -314,54 +379,74 @@ double Statistic::getThirdQuartile() const {
 }
 
 /*
- * This assigns the values of the rhs object to this object. Therefore this
- * object first deletes every value it contains. Afterwards the statistical
- * values are calculated.
+ * This assigns the values and the statistical values of the rhs object to this
+ * object. The old values of this object are freed by the lists.
  */
-Statistic& Statistic::operator =(const Statistic& rhs) {
-    if(this == &rhs){  // the objects are the same
-        return *this;
-    }
+Statistic& Statistic::operator =(const Statistic& rhs) = default;
 
-    /*delete the old values of this object*/
-    if(this->mSeries != nullptr){
-        delete this->mSeries;
-        this->mSeries = nullptr;
-    }
-
-    if(this->mSortedSeries != nullptr){
-        delete this->mSortedSeries;
-        this->mSortedSeries = nullptr;
+/*
+ * The lists are moved, the statistical values copied. The statistical values
+ * of rhs are reset afterwards, so it is a consistent empty object, including
+ * its moments returned by getRunningStatistic().
+ */
+Statistic& Statistic::operator =(Statistic&& rhs) {
+    if(this == &rhs) {
+        return *this;
     }
 
-    /*copy and assign the new values*/
-    this->mSeries = new std::list<double>(*(rhs.mSeries));
-    this->mSortedSeries = new std::list<double>(*(rhs.mSortedSeries));
-
-    /*calculate the new statistics*/
-    this->calculateStatistics();
+    this->mSeries = std::move(rhs.mSeries);
+    this->mSortedSeries = std::move(rhs.mSortedSeries);
+    this->mNumberOfElements = rhs.mNumberOfElements;
+    this->mPopulationSize = rhs.mPopulationSize;
+    this->mMean = rhs.mMean;
+    this->mMin = rhs.mMin;
+    this->mMax = rhs.mMax;
+    this->mStddev = rhs.mStddev;
+    this->mVariance = rhs.mVariance;
+    this->mMedian = rhs.mMedian;
+    this->mFirstQuartile = rhs.mFirstQuartile;
+    this->mThirdQuartile = rhs.mThirdQuartile;
+
+    rhs.mSeries.clear();
+    rhs.mPopulationSize = 0;
+    rhs.calculateStatistics();
 
     return *this;
 }
 
 /*
- * This adds a list of values to this object. The statistical values are re-
- * calculated afterwards.
+ * This adds a list of values to this object. Instead of calculating everything
+ * again, the moments of the new values are merged with the ones of this object
+ * and only the new values are sorted.
  */
 Statistic& Statistic::operator +=(const std::list<double>* listToAdd) {
+    RunningStatistic moments = this->getRunningStatistic();
+    std::size_t sortedSize = this->mSortedSeries.size();
+
+    moments += RunningStatistic(listToAdd->begin(), listToAdd->end());
+
     /*add all new elements to this series*/
     for(double element: *(listToAdd)){
-        this->mSeries->push_back(element);
+        this->mSeries.push_back(element);
     }
 
-    /*delete the old sorted list*/
-    if(this->mSortedSeries != nullptr){
-        delete this->mSortedSeries;
-        this->mSortedSeries = nullptr;
-    }
+    /*sort the new elements and merge them into the sorted series*/
+    this->mSortedSeries.insert(this->mSortedSeries.end(), listToAdd->begin(),
+        listToAdd->end());
+    std::sort(this->mSortedSeries.begin() + sortedSize,
+        this->mSortedSeries.end());
+    std::inplace_merge(this->mSortedSeries.begin(),
+        this->mSortedSeries.begin() + sortedSize, this->mSortedSeries.end());
+
+    this->mNumberOfElements = this->mSeries.size();
+    this->mMean = moments.getMean();
+    this->mMin = moments.getMin();
+    this->mMax = moments.getMax();
+    this->mVariance = moments.getVariance();
+    this->mStddev = moments.getStddev();
 
-    /*re-calculate the statistical values.*/
-    this->calculateStatistics();
+    /*calculate the percentiles 25, 50 and 75*/
+    this->calculateQuartiles();
 
     /*delete the input list*/
     delete listToAdd;
@@ -374,7 +459,7 @@ Statistic& Statistic::operator +=(const std::list<double>* listToAdd) {
  * This adds a list of values to a new object. The statistical values are re-
  * calculated afterwards.
  */
-const Statistic Statistic::operator +(const std::list<double>* listToAdd) {
+Statistic Statistic::operator +(const std::list<double>* listToAdd) const & {
     Statistic newStatistic = *this;
 
     /*add the input list to the new Statistic object. This deletes the list.*/
@@ -383,6 +468,15 @@ const Statistic Statistic::operator +(const std::list<double>* listToAdd) {
     return newStatistic;
 }
 
+/*
+ * This object is a temporary, so the list is added to it instead of a copy.
+ */
+Statistic Statistic::operator +(const std::list<double>* listToAdd) && {
+    *this += listToAdd;
+
+    return std::move(*this);
+}
+
 /*
  * Checks for the same size of the series of values.
  */
@@ -36,9 +36,13 @@
 #ifndef STATISTIC_H
 #define	STATISTIC_H
 
+#include <cstddef>
+#include <cstdint>
 #include <list>
+#include <vector>
 #include <cmath>
 #include "Timerseries.h"
+#include "RunningStatistic.h"
 
 /**
  * \brief This class calculates statistical values of series of times.
@@ -52,6 +56,31 @@
  */
 class Statistic {
 public:
+    /**
+     * \brief The methods to calculate a percentile p of n sorted values.
+     *
+     * The values are indexed from 1 to n.
+     */
+    enum PercentileMethod {
+        /**
+         * The value of rank ceil(p / 100 * n), an observed value.
+         */
+        NEAREST_RANK,
+
+        /**
+         * With h = p / 100 * n, the value of rank floor(h) + 1. If h is an
+         * integer, the mean of the values of rank h and h + 1. This is type 2
+         * of Hyndman and Fan and used for the quartiles.
+         */
+        AVERAGED,
+
+        /**
+         * With h = (n - 1) * p / 100 + 1, the linear interpolation between the
+         * values of rank floor(h) and floor(h) + 1. This is type 7 of Hyndman
+         * and Fan, the default of R and NumPy.
+         */
+        LINEAR
+    };
 
     /**
      * \brief Standard constructor
@@ -68,27 +97,61 @@ public:
      * can come from a Timerseries an represent times. It then calculates the
      * basic statistical values from this list.
      *
-     * The newly created object handles the series of doubles. It will delete
-     * this series upon deletion.
+     * The newly created object takes over the values and deletes the list
+     * right away, so the pointer must not be used afterwards.
      * @param series
      */
     Statistic(std::list<double>* series);
 
     /**
-     * brief Constructs a deep copy from another Statistic object
+     * \brief Construct a Statistic object from a series of doubles.
+     *
+     * The values are moved into this object without copying them.
+     * @param series
+     */
+    Statistic(std::list<double>&& series);
+
+    /**
+     * \brief Construct a Statistic object from a range of values.
+     *
+     * The values are copied once into the series of this object. Use it with
+     * the views of Timerseries to avoid a temporary list:
+     * \code
+     * TimerValueView<Timer> times = series.viewTimesInSeconds();
+     * Statistic statistic(times.begin(), times.end());
+     * \endcode
+     * @param first
+     * @param last
+     */
+    template<class InputIterator>
+    Statistic(InputIterator first, InputIterator last) : Statistic() {
+        this->mSeries.assign(first, last);
+
+        this->calculateStatistics();
+    }
+
+    /**
+     * \brief Constructs a deep copy from another Statistic object
      *
-     * This method deep copies the values of the original object and calculates
-     * the statistical values afterwards. Both objects are independend, since
-     * all values are copied.
+     * This method deep copies the values and the statistical values of the
+     * original object, nothing is calculated again. Both objects are
+     * independend, since all values are copied.
      * @param orig
      */
     Statistic(const Statistic& orig);
 
+    /**
+     * \brief Moves the values of another Statistic object into this one.
+     *
+     * No value is copied. The original object is left empty.
+     * @param orig
+     */
+    Statistic(Statistic&& orig);
+
     /**
      * \brief Delete the object.
      *
-     * This also deletes all series of elements within this object. Be careful
-     * not to delete the series twice.
+     * The values are freed with this object.
      */
     virtual ~Statistic();
 
@@ -106,20 +169,30 @@ public:
     /**
      * \brief Assign the rhs objects values to this object.
      *
-     * This object deletes its values before deep copying the values of rhs.
-     * Afterwards both objects are independent. Beware of deleting the series of
-     * values originally contained in this object since it will be deleted by
-     * this operation.
+     * This object deletes its values before deep copying the values and the
+     * statistical values of rhs. Afterwards both objects are independent.
      * @param rhs
      */
     Statistic& operator=(const Statistic& rhs);
 
+    /**
+     * \brief Move the values of rhs into this object.
+     *
+     * No value is copied. rhs is left empty.
+     * @param rhs
+     */
+    Statistic& operator=(Statistic&& rhs);
+
     /**
      * \brief Adds all the values to this object and recalculate the statistical
      * values.
      *
      * This adds all the values to this objects series. The original list will
      * be deleted after all values are added to this objects series.
+     *
+     * The mean and the variance are merged with the ones of the new values,
+     * see RunningStatistic, and the sorted new values are merged into the
+     * sorted series. This takes O(n + k log k) time for k new values.
      * @param listToAdd
      */
     Statistic& operator+=(const std::list<double>* listToAdd);
@@ -131,7 +204,15 @@ public:
      * list will be deleted after all values are added to this objects series.
      * @param listToAdd
      */
-    const Statistic operator+(const std::list<double>* listToAdd);
+    Statistic operator+(const std::list<double>* listToAdd) const &;
+
+    /**
+     * \brief Adds the values to this temporary object and returns it.
+     *
+     * The values of this object are not copied, see operator+=().
+     * @param listToAdd
+     */
+    Statistic operator+(const std::list<double>* listToAdd) &&;
 
     /**
      * \brief Compares both series for equal size.
@@ -212,21 +293,73 @@ public:
      */
     double getThirdQuartile() const;
 
+    /**
+     * \brief Returns an arbitrary percentile of the values.
+     *
+     * The values are kept sorted in an array, so this takes O(1) time. Returns
+     * 0, if there are no values or if percentile is not within [0, 100].
+     * @param percentile E.g. 99.9
+     * @param method See PercentileMethod
+     */
+    double getPercentile(double percentile,
+        PercentileMethod method = LINEAR) const;
+
+    /**
+     * \brief Returns several percentiles of the values at once.
+     *
+     * See getPercentile(double, PercentileMethod).
+     * @param percentiles The percentiles to calculate, e.g. {99, 99.9, 99.99}
+     * @param results Receives the percentile of each element of percentiles
+     * @param count The number of percentiles
+     * @param method See PercentileMethod
+     */
+    void getPercentiles(const double* percentiles, double* results,
+        std::size_t count, PercentileMethod method = LINEAR) const;
+
+    /**
+     * \brief Returns the values in ascending order.
+     */
+    const std::vector<double>& getSortedSeries() const;
+
     /**
      * \brief Returns the number of elements stored in this object.
      */
     int getNumberOfElements() const;
 
+    /**
+     * \brief Returns the number of elements the values are a sample of.
+     *
+     * This equals getNumberOfElements(), unless the values are a sample of a
+     * larger population, e.g. of a ReservoirTimerseries.
+     */
+    std::uint64_t getPopulationSize() const;
+
+    /**
+     * \brief Returns the number of elements, mean, variance, minimum and
+     * maximum as a RunningStatistic.
+     *
+     * This allows to merge it with other RunningStatistic objects.
+     */
+    RunningStatistic getRunningStatistic() const;
+
+    /**
+     * \brief Sets the number of elements the values are a sample of.
+     *
+     * The statistical values are still calculated from the sample only.
+     * @param populationSize
+     */
+    void setPopulationSize(std::uint64_t populationSize);
+
 private:
 
     void calculateStatistics();
-    double getPercentile(int percentile,
-        const std::list<double>* sortedValues) const;
+    void calculateQuartiles();
 
-    std::list<double>* mSeries;
-    std::list<double>* mSortedSeries;
+    std::list<double> mSeries;
+    std::vector<double> mSortedSeries;
 
     int mNumberOfElements;
+    std::uint64_t mPopulationSize;
 
     double mMean, mMin, mMax,
         mStddev, mVariance, mMedian,
@@ -0,0 +1,555 @@
+/*
+ * File:   TDigest.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 23, 2026, 10:05 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#include "TDigest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+/* "TDG" and the version of the format */
+const std::uint8_t MAGIC[4] = {'T', 'D', 'G', 1};
+
+/* the buffer holds this many values per unit of compression */
+const std::size_t BUFFER_FACTOR = 5;
+
+/* the centroids are bounded by the scale function k2 of Dunning,
+ * c * log(q / (1 - q)): a centroid spans at most 1 in k. The centroids at the
+ * extremes hold single values, so the error of a percentile is small relative
+ * to its distance to 0 or 100. This returns exp(-1 / c) */
+double getScaleStep(double compression, double total) {
+    double normalizer = 4 * std::log(std::max(total / compression, 1.0)) + 24;
+
+    return std::exp(-normalizer / compression);
+}
+
+/* the largest quantile a centroid starting at quantile may reach */
+double getQuantileLimit(double quantile, double step) {
+    return quantile / (quantile + (1 - quantile) * step);
+}
+
+/* the average of x1 and x2, weighted and kept within both */
+double getWeightedAverage(double x1, double w1, double x2, double w2) {
+    double value = (x1 * w1 + x2 * w2) / (w1 + w2);
+
+    return std::max(std::min(x1, x2), std::min(value, std::max(x1, x2)));
+}
+
+void writeDouble(std::vector<std::uint8_t>& blob, double value) {
+    std::uint64_t bits;
+
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    for(int i = 0; i < 8; ++i) {
+        blob.push_back(static_cast<std::uint8_t>(bits >> (8 * i)));
+    }
+}
+
+void writeVarint(std::vector<std::uint8_t>& blob, std::uint64_t value) {
+    while(value >= 0x80) {
+        blob.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+
+    blob.push_back(static_cast<std::uint8_t>(value));
+}
+
+double readDouble(const std::uint8_t* data, std::size_t size,
+        std::size_t& position) {
+    if(size - position < 8) {
+        throw std::invalid_argument("TDigest: truncated data");
+    }
+
+    std::uint64_t bits = 0;
+    double value;
+
+    for(int i = 0; i < 8; ++i) {
+        bits |= static_cast<std::uint64_t>(data[position++]) << (8 * i);
+    }
+
+    std::memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}
+
+std::uint64_t readVarint(const std::uint8_t* data, std::size_t size,
+        std::size_t& position) {
+    std::uint64_t value = 0;
+
+    for(int shift = 0; shift < 64; shift += 7) {
+        if(position >= size) {
+            throw std::invalid_argument("TDigest: truncated data");
+        }
+
+        std::uint8_t byte = data[position++];
+
+        value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+
+        if((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+
+    throw std::invalid_argument("TDigest: invalid count");
+}
+
+}
+
+const int TDigest::DEFAULT_COMPRESSION;
+const int TDigest::MIN_COMPRESSION;
+const int TDigest::MAX_COMPRESSION;
+
+/*
+ * Creates an empty digest. A tiny compression would merge everything into a
+ * few centroids, a huge one would not fit the size of the buffer.
+ */
+TDigest::TDigest(double compression) :
+    mCompression(!(compression >= MIN_COMPRESSION) ? MIN_COMPRESSION
+        : compression > MAX_COMPRESSION ? MAX_COMPRESSION : compression),
+    mTotalCount(0),
+    mSum(0),
+    mMin(0),
+    mMax(0),
+    mCentroids(),
+    mBuffer() {
+    this->mBuffer.reserve(
+        BUFFER_FACTOR * static_cast<std::size_t>(this->mCompression));
+}
+
+/*
+ * The values of the Statistic are added one by one.
+ */
+TDigest::TDigest(const Statistic& statistic, double compression) :
+    TDigest(compression) {
+    this->add(statistic);
+}
+
+/*
+ * The centroids and the buffer are copied.
+ */
+TDigest::TDigest(const TDigest& orig) = default;
+
+/*
+ * The centroids and the buffer are moved.
+ */
+TDigest::TDigest(TDigest&& orig) = default;
+
+/*
+ * The centroids and the buffer are copied.
+ */
+TDigest& TDigest::operator=(const TDigest& rhs) = default;
+
+/*
+ * The centroids and the buffer are moved.
+ */
+TDigest& TDigest::operator=(TDigest&& rhs) = default;
+
+/*
+ * The vectors free themselves.
+ */
+TDigest::~TDigest() {
+}
+
+/*
+ * Sorts the buffered values together with the centroids and merges neighbours
+ * as long as the merged centroid stays below the limit of its first quantile.
+ */
+void TDigest::compress() const {
+    if(this->mBuffer.empty()) {
+        return;
+    }
+
+    std::vector<Centroid>& values = this->mBuffer;
+
+    values.insert(values.end(), this->mCentroids.begin(),
+        this->mCentroids.end());
+    std::sort(values.begin(), values.end(),
+        [](const Centroid& lhs, const Centroid& rhs) {
+            return lhs.mMean < rhs.mMean;
+        });
+
+    double total = static_cast<double>(this->mTotalCount);
+    double countSoFar = 0;
+    double step = getScaleStep(this->mCompression, total);
+    double quantileLimit = 0;
+    Centroid current = values.front();
+
+    this->mCentroids.clear();
+
+    for(std::size_t i = 1; i < values.size(); ++i) {
+        const Centroid& next = values[i];
+        double quantile = (countSoFar + current.mCount + next.mCount) / total;
+
+        if(quantile <= quantileLimit) {
+            current.mCount += next.mCount;
+            current.mMean += (next.mMean - current.mMean) * next.mCount
+                / current.mCount;
+        } else {
+            this->mCentroids.push_back(current);
+            countSoFar += current.mCount;
+            quantileLimit = getQuantileLimit(countSoFar / total, step);
+            current = next;
+        }
+    }
+
+    this->mCentroids.push_back(current);
+    values.clear();
+}
+
+/*
+ * Values are buffered, the buffer is merged when it is full.
+ */
+void TDigest::add(double value, std::uint64_t count) {
+    if(count == 0 or std::isnan(value)) {
+        return;
+    }
+
+    if(this->mTotalCount == 0) {
+        this->mMin = value;
+        this->mMax = value;
+    } else {
+        this->mMin = std::min(this->mMin, value);
+        this->mMax = std::max(this->mMax, value);
+    }
+
+    this->mTotalCount += count;
+    this->mSum += value * count;
+    this->mBuffer.push_back(Centroid{value, count});
+
+    if(this->mBuffer.size()
+            >= BUFFER_FACTOR * static_cast<std::size_t>(this->mCompression)) {
+        this->compress();
+    }
+}
+
+/*
+ * The sorted values of the Statistic are added.
+ */
+void TDigest::add(const Statistic& statistic) {
+    for(double value: statistic.getSortedSeries()) {
+        this->add(value);
+    }
+}
+
+/*
+ * The centroids of rhs are merged like buffered values.
+ */
+void TDigest::merge(const TDigest& rhs) {
+    if(rhs.mTotalCount == 0) {
+        return;
+    }
+
+    rhs.compress();
+
+    if(this->mTotalCount == 0) {
+        this->mMin = rhs.mMin;
+        this->mMax = rhs.mMax;
+    } else {
+        this->mMin = std::min(this->mMin, rhs.mMin);
+        this->mMax = std::max(this->mMax, rhs.mMax);
+    }
+
+    this->mTotalCount += rhs.mTotalCount;
+    this->mSum += rhs.mSum;
+    this->mBuffer.insert(this->mBuffer.end(), rhs.mCentroids.begin(),
+        rhs.mCentroids.end());
+    this->compress();
+}
+
+/*
+ * This is merge().
+ */
+TDigest& TDigest::operator+=(const TDigest& rhs) {
+    this->merge(rhs);
+
+    return *this;
+}
+
+/*
+ * Removes the centroids and the buffered values.
+ */
+void TDigest::clear() {
+    this->mTotalCount = 0;
+    this->mSum = 0;
+    this->mMin = 0;
+    this->mMax = 0;
+    this->mCentroids.clear();
+    this->mBuffer.clear();
+}
+
+/*
+ * The format is the magic bytes, the compression, the sum, the minimum, the
+ * maximum and the number of centroids, followed by the mean and count of each
+ * centroid. Doubles are stored as little endian IEEE 754, counts as varints.
+ */
+std::vector<std::uint8_t> TDigest::serialize() const {
+    std::vector<std::uint8_t> blob(MAGIC, MAGIC + sizeof(MAGIC));
+
+    this->compress();
+    blob.reserve(sizeof(MAGIC) + 4 * 8 + 10
+        + this->mCentroids.size() * (8 + 10));
+
+    writeDouble(blob, this->mCompression);
+    writeDouble(blob, this->mSum);
+    writeDouble(blob, this->mMin);
+    writeDouble(blob, this->mMax);
+    writeVarint(blob, this->mCentroids.size());
+
+    for(const Centroid& centroid: this->mCentroids) {
+        writeDouble(blob, centroid.mMean);
+        writeVarint(blob, centroid.mCount);
+    }
+
+    return blob;
+}
+
+/*
+ * Reads the format of serialize() and checks that the centroids are sorted.
+ */
+TDigest TDigest::deserialize(const std::uint8_t* data, std::size_t size) {
+    std::size_t position = sizeof(MAGIC);
+
+    if(data == nullptr or size < sizeof(MAGIC)
+            or std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::invalid_argument("TDigest: unknown format");
+    }
+
+    double compression = readDouble(data, size, position);
+
+    /* the constructor would clamp it, and so change the digest */
+    if(!(compression >= MIN_COMPRESSION and compression <= MAX_COMPRESSION)) {
+        throw std::invalid_argument("TDigest: invalid compression");
+    }
+
+    TDigest digest(compression);
+
+    digest.mSum = readDouble(data, size, position);
+    digest.mMin = readDouble(data, size, position);
+    digest.mMax = readDouble(data, size, position);
+
+    std::uint64_t count = readVarint(data, size, position);
+
+    if(count > 0 and !(digest.mMin <= digest.mMax)) {
+        throw std::invalid_argument("TDigest: invalid extremes");
+    }
+
+    /* each centroid takes at least 9 bytes */
+    if(count > (size - position) / 9) {
+        throw std::invalid_argument("TDigest: truncated data");
+    }
+
+    digest.mCentroids.reserve(count);
+
+    for(std::uint64_t i = 0; i < count; ++i) {
+        Centroid centroid;
+
+        centroid.mMean = readDouble(data, size, position);
+        centroid.mCount = readVarint(data, size, position);
+
+        if(centroid.mCount == 0 or !(centroid.mMean >= digest.mMin)
+                or !(centroid.mMean <= digest.mMax)
+                or (i > 0 and centroid.mMean
+                    < digest.mCentroids.back().mMean)) {
+            throw std::invalid_argument("TDigest: invalid centroid");
+        }
+
+        digest.mTotalCount += centroid.mCount;
+        digest.mCentroids.push_back(centroid);
+    }
+
+    if(position != size) {
+        throw std::invalid_argument("TDigest: trailing data");
+    }
+
+    return digest;
+}
+
+/*
+ * Reads the whole blob.
+ */
+TDigest TDigest::deserialize(const std::vector<std::uint8_t>& blob) {
+    return TDigest::deserialize(blob.data(), blob.size());
+}
+
+/*
+ * This returns the number of values.
+ */
+std::uint64_t TDigest::getNumberOfElements() const {
+    return this->mTotalCount;
+}
+
+/*
+ * The minimum is exact.
+ */
+double TDigest::getMin() const {
+    return this->mMin;
+}
+
+/*
+ * The maximum is exact.
+ */
+double TDigest::getMax() const {
+    return this->mMax;
+}
+
+/*
+ * The mean is exact, apart from rounding.
+ */
+double TDigest::getMean() const {
+    return this->mTotalCount == 0 ? 0 : this->mSum / this->mTotalCount;
+}
+
+/*
+ * This returns the median value.
+ */
+double TDigest::getMedian() const {
+    return this->getPercentile(50);
+}
+
+/*
+ * This returns the value of the first quartile.
+ */
+double TDigest::getFirstQuartile() const {
+    return this->getPercentile(25);
+}
+
+/*
+ * This returns the value of the third quartile.
+ */
+double TDigest::getThirdQuartile() const {
+    return this->getPercentile(75);
+}
+
+/*
+ * The values of a centroid are assumed to spread evenly around its mean, so
+ * the rank of its mean is in its middle. Between the middles of two centroids
+ * the value is interpolated, beyond the outer ones up to the extremes. A
+ * centroid of a single value is exact.
+ */
+double TDigest::getPercentile(double percentile) const {
+    if(this->mTotalCount == 0 or percentile < 0 or percentile > 100) {
+        return 0;
+    }
+
+    this->compress();
+
+    const std::vector<Centroid>& centroids = this->mCentroids;
+    double total = static_cast<double>(this->mTotalCount);
+    double index = percentile / 100.0 * total;
+
+    if(centroids.size() == 1 and centroids.front().mCount == 1) {
+        return centroids.front().mMean;
+    }
+
+    if(index < 1) {
+        return this->mMin;
+    }
+
+    const Centroid& first = centroids.front();
+    const Centroid& last = centroids.back();
+
+    if(first.mCount > 1 and index < first.mCount / 2.0) {
+        return this->mMin + (index - 1) / (first.mCount / 2.0 - 1)
+            * (first.mMean - this->mMin);
+    }
+
+    if(index > total - 1) {
+        return this->mMax;
+    }
+
+    if(last.mCount > 1 and total - index <= last.mCount / 2.0) {
+        return this->mMax - (total - index - 1) / (last.mCount / 2.0 - 1)
+            * (this->mMax - last.mMean);
+    }
+
+    double countSoFar = first.mCount / 2.0;
+
+    for(std::size_t i = 0; i + 1 < centroids.size(); ++i) {
+        const Centroid& left = centroids[i];
+        const Centroid& right = centroids[i + 1];
+        double distance = (left.mCount + right.mCount) / 2.0;
+
+        if(countSoFar + distance > index) {
+            double leftUnit = 0;
+            double rightUnit = 0;
+
+            if(left.mCount == 1) {
+                if(index - countSoFar < 0.5) {
+                    return left.mMean;
+                }
+
+                leftUnit = 0.5;
+            }
+
+            if(right.mCount == 1) {
+                if(countSoFar + distance - index <= 0.5) {
+                    return right.mMean;
+                }
+
+                rightUnit = 0.5;
+            }
+
+            return getWeightedAverage(left.mMean,
+                countSoFar + distance - index - rightUnit, right.mMean,
+                index - countSoFar - leftUnit);
+        }
+
+        countSoFar += distance;
+    }
+
+    return this->mMax;
+}
+
+/*
+ * Returns the bound of the number of centroids.
+ */
+double TDigest::getCompression() const {
+    return this->mCompression;
+}
+
+/*
+ * Merges the buffer to count the centroids.
+ */
+std::size_t TDigest::getCentroidCount() const {
+    this->compress();
+
+    return this->mCentroids.size();
+}
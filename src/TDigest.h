@@ -0,0 +1,327 @@
+/*
+ * File:   TDigest.h
+ * Author: Nils Döring
+ *
+ * Created on October 23, 2026, 10:05 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+#ifndef TDIGEST_H
+#define	TDIGEST_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Timestamp.h"
+#include "Timer.h"
+#include "Timerseries.h"
+#include "ContiguousTimerseries.h"
+#include "TimeView.h"
+#include "Statistic.h"
+
+/**
+ * \brief This class estimates percentiles of a stream of values in a small,
+ * mergeable summary.
+ *
+ * The values are summarized by a t-digest of Ted Dunning: a sorted list of
+ * centroids, each a mean and a number of values. Centroids near the minimum
+ * and the maximum hold few values, centroids near the median many, so the
+ * error of a percentile is small relative to its distance to 0 or 100. The
+ * number of centroids is bounded by the compression, 100 by default,
+ * independent of the number of values.
+ *
+ * Digests of different processes are merged with merge() and exchanged as
+ * byte blobs of less than a kilobyte:
+ * \code
+ * TDigest digest(series);  // in nanoseconds
+ * std::vector<std::uint8_t> blob = digest.serialize();
+ * ...
+ * TDigest fleet;
+ * fleet.merge(TDigest::deserialize(blob));
+ * fleet.getPercentile(99);
+ * \endcode
+ *
+ * Unlike averaging the percentiles of each process, the percentiles of the
+ * merged digest are percentiles of all values. The getters provide the same
+ * names as Statistic.
+ *
+ * \attention This class is not thread-safe, not even the getters.
+ */
+class TDigest {
+public:
+    /**
+     * \brief The default compression.
+     */
+    static const int DEFAULT_COMPRESSION = 100;
+
+    /**
+     * \brief The smallest compression.
+     */
+    static const int MIN_COMPRESSION = 10;
+
+    /**
+     * \brief The largest compression.
+     *
+     * The buffer is reserved in proportion to the compression, so this bounds
+     * the memory of a digest.
+     */
+    static const int MAX_COMPRESSION = 100000;
+
+    /**
+     * \brief Creates an empty digest.
+     *
+     * A larger compression keeps more centroids and gives more accurate
+     * percentiles.
+     * @param compression The bound of the number of centroids, clamped to
+     * MIN_COMPRESSION and MAX_COMPRESSION
+     */
+    explicit TDigest(double compression = DEFAULT_COMPRESSION);
+
+    /**
+     * \brief Creates a digest of the durations of a Timerseries.
+     *
+     * The durations are added in nanoseconds.
+     * @param series
+     * @param compression See TDigest(double)
+     */
+    template<class Clock, class TimerType, class Allocator>
+    explicit TDigest(
+            const BasicTimerseries<Clock, TimerType, Allocator>& series,
+            double compression = DEFAULT_COMPRESSION) :
+            TDigest(compression) {
+        this->add(series);
+    }
+
+    /**
+     * \brief Creates a digest of the values of a Statistic.
+     * @param statistic
+     * @param compression See TDigest(double)
+     */
+    explicit TDigest(const Statistic& statistic,
+        double compression = DEFAULT_COMPRESSION);
+
+    /**
+     * \brief Copy constructor.
+     * @param orig
+     */
+    TDigest(const TDigest& orig);
+
+    /**
+     * \brief Move constructor.
+     * @param orig
+     */
+    TDigest(TDigest&& orig);
+
+    /**
+     * \brief Assignment operator.
+     * @param rhs
+     */
+    TDigest& operator=(const TDigest& rhs);
+
+    /**
+     * \brief Move assignment operator.
+     * @param rhs
+     */
+    TDigest& operator=(TDigest&& rhs);
+
+    /**
+     * \brief Standard destructor.
+     */
+    virtual ~TDigest();
+
+    /**
+     * \brief Adds the value count times.
+     *
+     * Values are collected in a buffer and merged into the centroids when it
+     * is full, so this takes amortized O(log compression) time.
+     * @param value
+     * @param count
+     */
+    void add(double value, std::uint64_t count = 1);
+
+    /**
+     * \brief Adds the duration of the Timer in nanoseconds.
+     * @param timer
+     */
+    template<class Clock>
+    void add(const BasicTimer<Clock>& timer) {
+        this->add(static_cast<double>(timer.getTime().getTotalNanoSeconds()));
+    }
+
+    /**
+     * \brief Adds the durations of all Timer in nanoseconds.
+     * @param series
+     */
+    template<class Clock, class TimerType, class Allocator>
+    void add(const BasicTimerseries<Clock, TimerType, Allocator>& series) {
+        for(const Timestamp& time: series.viewTimes()) {
+            this->add(static_cast<double>(time.getTotalNanoSeconds()));
+        }
+    }
+
+    /**
+     * \brief Adds the durations of all measurements in nanoseconds.
+     * @param series
+     */
+    template<class Clock>
+    void add(const BasicContiguousTimerseries<Clock>& series) {
+        for(double time: series.viewTimesInNanoSeconds()) {
+            this->add(time);
+        }
+    }
+
+    /**
+     * \brief Adds all values of a Statistic.
+     * @param statistic
+     */
+    void add(const Statistic& statistic);
+
+    /**
+     * \brief Adds all values summarized by rhs.
+     *
+     * The compression of this digest is kept.
+     * @param rhs
+     */
+    void merge(const TDigest& rhs);
+
+    /**
+     * \brief Same as merge().
+     * @param rhs
+     */
+    TDigest& operator+=(const TDigest& rhs);
+
+    /**
+     * \brief Removes all values.
+     */
+    void clear();
+
+    /**
+     * \brief Writes the digest into a byte blob.
+     *
+     * The format does not depend on the byte order of the machine. A mean
+     * takes 8 bytes, a count 1 to 10 bytes.
+     */
+    std::vector<std::uint8_t> serialize() const;
+
+    /**
+     * \brief Reads a digest written by serialize().
+     *
+     * Throws std::invalid_argument, if the data is not a valid digest. This
+     * includes a compression outside MIN_COMPRESSION and MAX_COMPRESSION.
+     * @param data
+     * @param size The number of bytes
+     */
+    static TDigest deserialize(const std::uint8_t* data, std::size_t size);
+
+    /**
+     * \brief Reads a digest written by serialize().
+     *
+     * See deserialize(const std::uint8_t*, std::size_t).
+     * @param blob
+     */
+    static TDigest deserialize(const std::vector<std::uint8_t>& blob);
+
+    /**
+     * \brief Returns the number of values.
+     */
+    std::uint64_t getNumberOfElements() const;
+
+    /**
+     * \brief Returns the smallest value.
+     */
+    double getMin() const;
+
+    /**
+     * \brief Returns the largest value.
+     */
+    double getMax() const;
+
+    /**
+     * \brief Returns the mean of the values.
+     */
+    double getMean() const;
+
+    /**
+     * \brief Returns the estimated median of the values.
+     */
+    double getMedian() const;
+
+    /**
+     * \brief Returns the estimated first quartile of the values.
+     */
+    double getFirstQuartile() const;
+
+    /**
+     * \brief Returns the estimated third quartile of the values.
+     */
+    double getThirdQuartile() const;
+
+    /**
+     * \brief Returns an estimated arbitrary percentile of the values.
+     *
+     * The value is interpolated between the means of the neighbouring
+     * centroids. Returns 0, if there are no values or if percentile is not
+     * within [0, 100].
+     * @param percentile E.g. 99.9
+     */
+    double getPercentile(double percentile) const;
+
+    /**
+     * \brief Returns the compression.
+     */
+    double getCompression() const;
+
+    /**
+     * \brief Returns the number of centroids.
+     */
+    std::size_t getCentroidCount() const;
+
+private:
+    struct Centroid {
+        double mMean;
+        std::uint64_t mCount;
+    };
+
+    void compress() const;
+
+    double mCompression;
+    std::uint64_t mTotalCount;
+    double mSum, mMin, mMax;
+
+    /* the centroids are only merged when needed, even by the getters */
+    mutable std::vector<Centroid> mCentroids;
+    mutable std::vector<Centroid> mBuffer;
+};
+
+#endif	/* TDIGEST_H */
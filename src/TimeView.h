@@ -0,0 +1,419 @@
+/*
+ * File:   TimeView.h
+ * Author: Nils Döring
+ *
+ * Created on October 20, 2026, 4:20 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef TIMEVIEW_H
+#define	TIMEVIEW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include "Timestamp.h"
+#include "Calibration.h"
+
+/**
+ * \brief This class is a lazy view on one value of every Timer of a series.
+ *
+ * The value is read from each Timer by a getter, e.g.
+ * Timer::getTimeInSeconds(), while iterating. Nothing is copied or allocated,
+ * so a view can be passed directly to Statistic or written to an exporter in a
+ * single pass.
+ *
+ * \attention A view is invalidated by every modification of its series.
+ * \tparam TimerType The type of the Timer.
+ * \tparam Value The type returned by the getter.
+ */
+template<class TimerType, class Value = double>
+class TimerValueView {
+public:
+    /**
+     * \brief The type of the getter reading the value of a Timer.
+     */
+    typedef Value (TimerType::*Getter)() const;
+
+    /**
+     * \brief The iterator of a TimerValueView.
+     *
+     * It returns the values by value, so it is an input iterator.
+     */
+    class Iterator {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef typename std::remove_const<Value>::type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef value_type reference;
+
+        Iterator(TimerType* const* position, Getter getter) :
+            mPosition(position),
+            mGetter(getter) {
+        }
+
+        value_type operator*() const {
+            return ((*(this->mPosition))->*(this->mGetter))();
+        }
+
+        Iterator& operator++() {
+            ++(this->mPosition);
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous(*this);
+            ++(this->mPosition);
+            return previous;
+        }
+
+        bool operator==(const Iterator& rhs) const {
+            return this->mPosition == rhs.mPosition;
+        }
+
+        bool operator!=(const Iterator& rhs) const {
+            return this->mPosition != rhs.mPosition;
+        }
+
+    private:
+        TimerType* const* mPosition;
+        Getter mGetter;
+    };
+
+    /**
+     * \brief Creates a view on the Timer between first and last.
+     * @param first
+     * @param last
+     * @param getter
+     */
+    TimerValueView(TimerType* const* first, TimerType* const* last,
+            Getter getter) :
+        mFirst(first),
+        mLast(last),
+        mGetter(getter) {
+    }
+
+    /**
+     * \brief Returns an iterator to the value of the first Timer.
+     */
+    Iterator begin() const {
+        return Iterator(this->mFirst, this->mGetter);
+    }
+
+    /**
+     * \brief Returns an iterator past the value of the last Timer.
+     */
+    Iterator end() const {
+        return Iterator(this->mLast, this->mGetter);
+    }
+
+    /**
+     * \brief Returns the number of values.
+     */
+    std::size_t size() const {
+        return static_cast<std::size_t>(this->mLast - this->mFirst);
+    }
+
+    /**
+     * \brief Returns if there is no value.
+     */
+    bool empty() const {
+        return this->mFirst == this->mLast;
+    }
+
+private:
+    TimerType* const* mFirst;
+    TimerType* const* mLast;
+    Getter mGetter;
+};
+
+/**
+ * \brief This class is a lazy view on the Timer of a series.
+ *
+ * It iterates over references to the Timer instead of copying them.
+ *
+ * \attention A view is invalidated by every modification of its series.
+ * \tparam TimerType The type of the Timer.
+ */
+template<class TimerType>
+class TimerView {
+public:
+    /**
+     * \brief The iterator of a TimerView.
+     */
+    class Iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef TimerType value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const TimerType* pointer;
+        typedef const TimerType& reference;
+
+        explicit Iterator(TimerType* const* position) :
+            mPosition(position) {
+        }
+
+        const TimerType& operator*() const {
+            return **(this->mPosition);
+        }
+
+        const TimerType* operator->() const {
+            return *(this->mPosition);
+        }
+
+        Iterator& operator++() {
+            ++(this->mPosition);
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous(*this);
+            ++(this->mPosition);
+            return previous;
+        }
+
+        bool operator==(const Iterator& rhs) const {
+            return this->mPosition == rhs.mPosition;
+        }
+
+        bool operator!=(const Iterator& rhs) const {
+            return this->mPosition != rhs.mPosition;
+        }
+
+    private:
+        TimerType* const* mPosition;
+    };
+
+    /**
+     * \brief Creates a view on the Timer between first and last.
+     * @param first
+     * @param last
+     */
+    TimerView(TimerType* const* first, TimerType* const* last) :
+        mFirst(first),
+        mLast(last) {
+    }
+
+    /**
+     * \brief Returns an iterator to the first Timer.
+     */
+    Iterator begin() const {
+        return Iterator(this->mFirst);
+    }
+
+    /**
+     * \brief Returns an iterator past the last Timer.
+     */
+    Iterator end() const {
+        return Iterator(this->mLast);
+    }
+
+    /**
+     * \brief Returns the number of Timer.
+     */
+    std::size_t size() const {
+        return static_cast<std::size_t>(this->mLast - this->mFirst);
+    }
+
+    /**
+     * \brief Returns if there is no Timer.
+     */
+    bool empty() const {
+        return this->mFirst == this->mLast;
+    }
+
+private:
+    TimerType* const* mFirst;
+    TimerType* const* mLast;
+};
+
+/**
+ * \brief This class is a lazy view on durations given by pairs of readings.
+ *
+ * It converts the start and stop readings of a ContiguousTimerseries to
+ * durations in the given unit, or to frequencies, while iterating. The
+ * durations are corrected like Timer::getTime().
+ *
+ * \attention A view is invalidated by every modification of its series.
+ * \tparam Clock One of the clock policies defined in Clock.h.
+ */
+template<class Clock>
+class ReadingsView {
+public:
+    /**
+     * \brief The values a ReadingsView returns.
+     */
+    enum Unit {SECONDS, MILLISECONDS, MICROSECONDS, NANOSECONDS, HERTZ};
+
+    /**
+     * \brief The iterator of a ReadingsView.
+     *
+     * It returns the values by value, so it is an input iterator.
+     */
+    class Iterator {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef double value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const double* pointer;
+        typedef double reference;
+
+        Iterator(const std::int64_t* startTime, const std::int64_t* stopTime,
+                Unit unit) :
+            mStartTime(startTime),
+            mStopTime(stopTime),
+            mUnit(unit) {
+        }
+
+        double operator*() const {
+            std::int64_t ticks = Calibration<Clock>::correct(
+                *(this->mStopTime) - *(this->mStartTime));
+            double nanoSeconds = static_cast<double>(
+                Clock::toTimestamp(ticks).getTotalNanoSeconds());
+
+            switch(this->mUnit) {
+                case SECONDS:
+                    return nanoSeconds / 1000000000.0;
+                case MILLISECONDS:
+                    return nanoSeconds / 1000000.0;
+                case MICROSECONDS:
+                    return nanoSeconds / 1000.0;
+                case NANOSECONDS:
+                    return nanoSeconds;
+                case HERTZ:
+                    return nanoSeconds != 0.0 ? 1000000000.0 / nanoSeconds
+                        : 0.0;
+            }
+
+            return 0.0;
+        }
+
+        Iterator& operator++() {
+            ++(this->mStartTime);
+            ++(this->mStopTime);
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous(*this);
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(const Iterator& rhs) const {
+            return this->mStartTime == rhs.mStartTime;
+        }
+
+        bool operator!=(const Iterator& rhs) const {
+            return this->mStartTime != rhs.mStartTime;
+        }
+
+    private:
+        const std::int64_t* mStartTime;
+        const std::int64_t* mStopTime;
+        Unit mUnit;
+    };
+
+    /**
+     * \brief Creates a view on the given arrays of readings.
+     * @param startTimes
+     * @param stopTimes
+     * @param size The number of readings in each array
+     * @param unit
+     */
+    ReadingsView(const std::int64_t* startTimes, const std::int64_t* stopTimes,
+            std::size_t size, Unit unit) :
+        mStartTimes(startTimes),
+        mStopTimes(stopTimes),
+        mSize(size),
+        mUnit(unit) {
+    }
+
+    /**
+     * \brief Returns an iterator to the first value.
+     */
+    Iterator begin() const {
+        return Iterator(this->mStartTimes, this->mStopTimes, this->mUnit);
+    }
+
+    /**
+     * \brief Returns an iterator past the last value.
+     */
+    Iterator end() const {
+        return Iterator(this->mStartTimes + this->mSize,
+            this->mStopTimes + this->mSize, this->mUnit);
+    }
+
+    /**
+     * \brief Returns the number of values.
+     */
+    std::size_t size() const {
+        return this->mSize;
+    }
+
+    /**
+     * \brief Returns if there is no value.
+     */
+    bool empty() const {
+        return this->mSize == 0;
+    }
+
+private:
+    const std::int64_t* mStartTimes;
+    const std::int64_t* mStopTimes;
+    std::size_t mSize;
+    Unit mUnit;
+};
+
+/**
+ * \brief Copies the values of a view into the buffer.
+ *
+ * Copies at most size values and returns the number of copied values.
+ * @param view A TimerValueView or ReadingsView
+ * @param buffer
+ * @param size The number of values fitting into the buffer
+ */
+template<class View, class T>
+std::size_t copyView(const View& view, T* buffer, std::size_t size) {
+    std::size_t count = 0;
+
+    for(typename View::Iterator it = view.begin();
+            it != view.end() and count < size; ++it) {
+        buffer[count] = *it;
+        ++count;
+    }
+
+    return count;
+}
+
+#endif	/* TIMEVIEW_H */
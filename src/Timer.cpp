@@ -34,51 +34,85 @@
  */
 
 #include "Timer.h"
+#include "Calibration.h"
 
 #define THOUSAND    1000.0
 #define MILLION     1000000.0
 #define BILLION     1000000000.0
+
+/* the margin of error in nanoseconds, see HRTPP_ERROR_MARGIN */
+static const std::int64_t ERROR_MARGIN =
+    static_cast<std::int64_t>(HRTPP_ERROR_MARGIN * BILLION + 0.5);
+
 /*
- * Create a new Timer object. The Timestamps are set to zero.
+ * Create a new Timer object. The clock readings are set to zero.
  */
-Timer::Timer() :
-    mStartTime(0.0),
-    mStopTime(0.0),
+template<class Clock>
+BasicTimer<Clock>::BasicTimer() :
+    mStartTime(0),
+    mStopTime(0),
+    mPauseTime(0),
+    mPausedTicks(0),
     mIsRunning(false),
-    mIsReset(true){
+    mIsReset(true),
+    mIsPaused(false){
 }
 
 /*
- * Create a new object and copy the Timestamps and the current state to this
- * object.
+ * Create a new object and copy the clock readings and the current state to
+ * this object.
  */
-Timer::Timer(const Timer& orig) : Timer() {
+template<class Clock>
+BasicTimer<Clock>::BasicTimer(const BasicTimer& orig) : BasicTimer() {
     this->mStartTime = orig.mStartTime;
     this->mStopTime = orig.mStopTime;
+    this->mPauseTime = orig.mPauseTime;
+    this->mPausedTicks = orig.mPausedTicks;
 
     this->mIsRunning = orig.mIsRunning;
     this->mIsReset = orig.mIsReset;
+    this->mIsPaused = orig.mIsPaused;
+}
+
+/*
+ * Create a Timer that has been started and stopped at the given readings.
+ */
+template<class Clock>
+BasicTimer<Clock>::BasicTimer(const std::int64_t startTime,
+        const std::int64_t stopTime) :
+    mStartTime(startTime),
+    mStopTime(stopTime),
+    mPauseTime(0),
+    mPausedTicks(0),
+    mIsRunning(false),
+    mIsReset(false),
+    mIsPaused(false){
 }
 
 /*
  * There is nothing to do here.
  */
-Timer::~Timer() {
+template<class Clock>
+BasicTimer<Clock>::~BasicTimer() {
 }
 
 /*
  * Assign the values to this object. If the objects are the same, then there is
  * nothing to do.
  */
-Timer& Timer::operator=(const Timer& rhs) {
+template<class Clock>
+BasicTimer<Clock>& BasicTimer<Clock>::operator=(const BasicTimer& rhs) {
     if(this == &rhs){  // the objects are the same
         return *this;
     }
     this->mStartTime = rhs.mStartTime;
     this->mStopTime = rhs.mStopTime;
+    this->mPauseTime = rhs.mPauseTime;
+    this->mPausedTicks = rhs.mPausedTicks;
 
     this->mIsRunning = rhs.mIsRunning;
     this->mIsReset = rhs.mIsReset;
+    this->mIsPaused = rhs.mIsPaused;
 
     return *this;
 }
@@ -88,7 +122,8 @@ Timer& Timer::operator=(const Timer& rhs) {
  * only the duration of both objects is considered. A new Timestamp object is
  * returned containing the sum of the durations.
  */
-const Timestamp Timer::operator +(const Timer& rhs) const {
+template<class Clock>
+const Timestamp BasicTimer<Clock>::operator +(const BasicTimer& rhs) const {
     Timestamp sum = this->getTime();
     sum += rhs.getTime();
 
@@ -100,7 +135,8 @@ const Timestamp Timer::operator +(const Timer& rhs) const {
  * only the duration of both objects is considered. A new Timestamp object is
  * returned containing the difference of the durations.
  */
-const Timestamp Timer::operator -(const Timer& rhs) const {
+template<class Clock>
+const Timestamp BasicTimer<Clock>::operator -(const BasicTimer& rhs) const {
     Timestamp difference = this->getTime();
     difference -= rhs.getTime();
 
@@ -112,15 +148,16 @@ const Timestamp Timer::operator -(const Timer& rhs) const {
  * the durations is small enough to consider them as equal. This value is
  * arbitrarily chosen. You can set this value with the macro HRTPP_ERROR_MARGIN.
  * The bigger the margin is, the more duration difference are regarded as equal.
+ * The durations are compared as integral nanoseconds.
  */
-bool Timer::operator ==(const Timer& rhs) const {
+template<class Clock>
+bool BasicTimer<Clock>::operator ==(const BasicTimer& rhs) const {
     if(this == &rhs) {  // the objects are the same
         return true;
     } else {
-        double difference = fabs( this->getTimeInSeconds() -
-            rhs.getTimeInSeconds() );
+        std::int64_t difference = this->getDifference(rhs);
 
-        return difference <= HRTPP_ERROR_MARGIN;
+        return difference <= ERROR_MARGIN and difference >= -ERROR_MARGIN;
     }
 }
 
@@ -128,7 +165,8 @@ bool Timer::operator ==(const Timer& rhs) const {
  * If the objects are not equal, this returns true. It invertes the answer given
  * by the check for equality.
  */
-bool Timer::operator !=(const Timer& rhs) const {
+template<class Clock>
+bool BasicTimer<Clock>::operator !=(const BasicTimer& rhs) const {
     return !(*this == rhs);
 }
 
@@ -136,29 +174,32 @@ bool Timer::operator !=(const Timer& rhs) const {
  * This checks if this object is significantly larger, hence the error margin,
  * as the other object.
  */
-bool Timer::operator >(const Timer& rhs) const {
+template<class Clock>
+bool BasicTimer<Clock>::operator >(const BasicTimer& rhs) const {
     //has to be bigger than zero
-    double difference = this->getTimeInSeconds() - rhs.getTimeInSeconds();
+    std::int64_t difference = this->getDifference(rhs);
 
-    return (difference > HRTPP_ERROR_MARGIN and difference > 0.0);
+    return (difference > ERROR_MARGIN and difference > 0);
 }
 
 /*
  * This checks if this object is significantly smaller, hence the error margin,
  * as the other object.
  */
-bool Timer::operator <(const Timer& rhs) const {
+template<class Clock>
+bool BasicTimer<Clock>::operator <(const BasicTimer& rhs) const {
     // has to be smaller than zero
-    double difference = this->getTimeInSeconds() - rhs.getTimeInSeconds();
+    std::int64_t difference = this->getDifference(rhs);
 
-    return (fabs(difference) > HRTPP_ERROR_MARGIN and difference < 0.0);
+    return (difference < -ERROR_MARGIN and difference < 0);
 }
 
 /*
  * This check returns true, if the object is either significantly larger or of
  * the same size within the margin of error.
  */
-bool Timer::operator >=(const Timer& rhs) const {
+template<class Clock>
+bool BasicTimer<Clock>::operator >=(const BasicTimer& rhs) const {
     return (*this > rhs) or (*this == rhs);
 }
 
@@ -166,17 +207,19 @@ bool Timer::operator >=(const Timer& rhs) const {
  * This check returns true, if the object is either significantly smaller or of
  * the same size within the margin of error.
  */
-bool Timer::operator <=(const Timer& rhs) const {
+template<class Clock>
+bool BasicTimer<Clock>::operator <=(const BasicTimer& rhs) const {
     return (*this < rhs) or (*this == rhs);
 }
 
 /*
  * This method checks not only if the objects are the same and if the durations
  * are the same, but also if the starting and the ending times are the same.
- * With this you can check for duplicate objects. Since the Timestamps work
- * with integral types, there is no margin of error necessary.
+ * With this you can check for duplicate objects. Since the clock readings are
+ * integral types, there is no margin of error necessary.
  */
-bool Timer::isEqual(const Timer& rhs) const {
+template<class Clock>
+bool BasicTimer<Clock>::isEqual(const BasicTimer& rhs) const {
     if(this == &rhs) {  // the objects are the same
         return true;
     }
@@ -194,9 +237,10 @@ bool Timer::isEqual(const Timer& rhs) const {
  * Starts the Timer if has not been run previously and is not running at the
  * moment.
  */
-void Timer::start() {
+template<class Clock>
+void BasicTimer<Clock>::start() {
     if(this->mIsReset and !this->mIsRunning) {
-        this->mStartTime.setNow();
+        this->mStartTime = Clock::read();
 
         this->mIsReset = false;
         this->mIsRunning = true;
@@ -205,62 +249,174 @@ void Timer::start() {
 
 /*
  * Stops the Timer if two conditions are met. The Timer will not be changed if
- * it hasn't been started or if it is not running currently.
+ * it hasn't been started or if it is not running currently. A paused Timer is
+ * stopped at the moment it has been paused.
+ */
+template<class Clock>
+void BasicTimer<Clock>::stop() {
+    if(!this->mIsReset and this->mIsRunning) {
+        if(this->mIsPaused) {
+            this->mStopTime = this->mPauseTime;
+            this->mIsPaused = false;
+        } else {
+            this->mStopTime = Clock::read();
+        }
+
+        this->mIsRunning = false;
+    }
+}
+
+/*
+ * Same as start() with the reading of the caller.
+ */
+template<class Clock>
+void BasicTimer<Clock>::startAt(std::int64_t reading) {
+    if(this->mIsReset and !this->mIsRunning) {
+        this->mStartTime = reading;
+
+        this->mIsReset = false;
+        this->mIsRunning = true;
+    }
+}
+
+/*
+ * Same as stop() with the reading of the caller.
  */
-void Timer::stop() {
+template<class Clock>
+void BasicTimer<Clock>::stopAt(std::int64_t reading) {
     if(!this->mIsReset and this->mIsRunning) {
-        this->mStopTime.setNow();
+        if(this->mIsPaused) {
+            this->mStopTime = this->mPauseTime;
+            this->mIsPaused = false;
+        } else {
+            this->mStopTime = reading;
+        }
 
         this->mIsRunning = false;
     }
 }
 
+/*
+ * Pauses the Timer if it is running and not already paused. The reading is
+ * kept until the Timer is resumed or stopped.
+ */
+template<class Clock>
+void BasicTimer<Clock>::pause() {
+    if(this->mIsRunning and !this->mIsPaused) {
+        this->mPauseTime = Clock::read();
+
+        this->mIsPaused = true;
+    }
+}
+
+/*
+ * Resumes a paused Timer. The time since the pause is added to the paused time,
+ * which is excluded from the duration.
+ */
+template<class Clock>
+void BasicTimer<Clock>::resume() {
+    if(this->mIsPaused) {
+        this->mPausedTicks += Clock::read() - this->mPauseTime;
+
+        this->mIsPaused = false;
+    }
+}
+
 /*
  * This resets the Timer. It does not regard the current state. The Timer will
- * be stopped afterwards and the Timestamps are zeroed.
+ * be stopped afterwards and the clock readings are zeroed.
  */
-void Timer::reset() {
-    this->mStartTime.set(0.0);
-    this->mStopTime.set(0.0);
+template<class Clock>
+void BasicTimer<Clock>::reset() {
+    this->mStartTime = 0;
+    this->mStopTime = 0;
+    this->mPauseTime = 0;
+    this->mPausedTicks = 0;
 
     this->mIsRunning = false;
     this->mIsReset = true;
+    this->mIsPaused = false;
 }
 
 /*
  * Getter for the state of running.
  */
-bool Timer::isRunning() const {
+template<class Clock>
+bool BasicTimer<Clock>::isRunning() const {
     return this->mIsRunning;
 }
 
+/*
+ * Getter for the state of pausing.
+ */
+template<class Clock>
+bool BasicTimer<Clock>::isPaused() const {
+    return this->mIsPaused;
+}
+
 /*
  * Getter for the reset status.
  */
-bool Timer::isReset() const {
+template<class Clock>
+bool BasicTimer<Clock>::isReset() const {
     return this->mIsReset;
 }
 
 /*
  * Calculates the duration between the start and the stop. If the Timer is
  * currently running, this calculates the duration between the start and the
- * moment you call this method. The Timer will not be stopped by this.
+ * moment you call this method. The Timer will not be stopped by this. The clock
+ * readings are only converted to a Timestamp here. If enabled, the calibrated
+ * overhead of reading the clock is subtracted.
+ */
+template<class Clock>
+const Timestamp BasicTimer<Clock>::getTime() const {
+    std::int64_t ticks = Calibration<Clock>::correct(this->getElapsedTicks());
+
+    return Clock::toTimestamp(ticks);
+}
+
+/*
+ * Calculates the duration in the unit of the clock. The paused time is left
+ * out. While paused, the duration does not grow.
  */
-const Timestamp Timer::getTime() const {
-    if( this->isRunning() ) {  // the timer is currently running
-        return Timestamp() - this->mStartTime;
+template<class Clock>
+std::int64_t BasicTimer<Clock>::getElapsedTicks() const {
+    std::int64_t end;
+
+    if(this->mIsPaused) {  // the timer is paused
+        end = this->mPauseTime;
+    } else if( this->isRunning() ) {  // the timer is currently running
+        end = Clock::read();
+    } else {
+        end = this->mStopTime;
     }
 
-    Timestamp difference = this->mStopTime - this->mStartTime;
+    return end - this->mStartTime - this->mPausedTicks;
+}
 
-    return difference;
+/*
+ * Returns the reading of the clock at the start.
+ */
+template<class Clock>
+std::int64_t BasicTimer<Clock>::getStartTicks() const {
+    return this->mStartTime;
+}
+
+/*
+ * Returns the reading of the clock at the stop.
+ */
+template<class Clock>
+std::int64_t BasicTimer<Clock>::getStopTicks() const {
+    return this->mStopTime;
 }
 
 /*
  * This returns a double precission variable containing the duration this timer
  * was running. It returns the time as seconds.
  */
-double Timer::getTimeInSeconds() const {
+template<class Clock>
+double BasicTimer<Clock>::getTimeInSeconds() const {
     Timestamp difference = this->getTime();
 
     return difference.getTime();  // this returns the time in seconds
@@ -270,39 +426,27 @@ double Timer::getTimeInSeconds() const {
  * This returns a double precission variable containing the duration this timer
  * was running. It returns the time as milliseconds.
  */
-double Timer::getTimeInMilliSeconds() const {
-    Timestamp difference = this->getTime();
-
-    double timeInMilliSeconds = difference.getSeconds() * THOUSAND
-        + difference.getNanoSeconds() / MILLION;
-
-    return timeInMilliSeconds;
+template<class Clock>
+double BasicTimer<Clock>::getTimeInMilliSeconds() const {
+    return this->getTime().getTotalNanoSeconds() / MILLION;
 }
 
 /*
  * This returns a double precission variable containing the duration this timer
  * was running. It returns the time as microseconds.
  */
-double Timer::getTimeInMicroSeconds() const {
-    Timestamp difference = this->getTime();
-
-    double timeInMicroSeconds = difference.getSeconds() * MILLION
-        + difference.getNanoSeconds() / THOUSAND;
-
-    return timeInMicroSeconds;
+template<class Clock>
+double BasicTimer<Clock>::getTimeInMicroSeconds() const {
+    return this->getTime().getTotalNanoSeconds() / THOUSAND;
 }
 
 /*
  * This returns a double precission variable containing the duration this timer
  * was running. It returns the time as nanoseconds.
  */
-double Timer::getTimeInNanoSeconds() const {
-    Timestamp difference = this->getTime();
-
-    double timeInNanoSeconds = difference.getSeconds() * BILLION
-        + difference.getNanoSeconds();
-
-    return timeInNanoSeconds;
+template<class Clock>
+double BasicTimer<Clock>::getTimeInNanoSeconds() const {
+    return this->getTime().getTotalNanoSeconds();
 }
 
 /*
@@ -310,7 +454,8 @@ double Timer::getTimeInNanoSeconds() const {
  * results from the time the Timer was running. The unit is Hertz(Hz). If the
  * Timer was not run, the frequency returned will be 0.
  */
-double Timer::getFrequency() const {
+template<class Clock>
+double BasicTimer<Clock>::getFrequency() const {
     double time = this->getTimeInSeconds();
     double frequency;
 
@@ -322,3 +467,28 @@ double Timer::getFrequency() const {
 
     return frequency;
 }
+
+/*
+ * Returns the difference of both durations in nanoseconds.
+ */
+template<class Clock>
+std::int64_t BasicTimer<Clock>::getDifference(const BasicTimer& rhs) const {
+    return this->getTime().getTotalNanoSeconds()
+        - rhs.getTime().getTotalNanoSeconds();
+}
+
+/*
+ * The resolution is the one of the underlying clock.
+ */
+template<class Clock>
+Timestamp BasicTimer<Clock>::getResolution() {
+    return Clock::getResolution();
+}
+
+template class BasicTimer<RealtimeClock>;
+template class BasicTimer<MonotonicClock>;
+template class BasicTimer<MonotonicRawClock>;
+template class BasicTimer<BoottimeClock>;
+template class BasicTimer<ProcessCpuClock>;
+template class BasicTimer<ThreadCpuClock>;
+template class BasicTimer<TscClock>;
@@ -36,7 +36,9 @@
 #ifndef TIMER_H
 #define	TIMER_H
 
+#include <cstdint>
 #include "Timestamp.h"
+#include "Clock.h"
 
 #ifndef HRTPP_ERROR_MARGIN
 #define HRTPP_ERROR_MARGIN 10e-08
@@ -45,19 +47,25 @@
 /**
  * \brief This class implements a simple start/stop timer.
  *
- * A Timer combines two Timestamps, one for the start time and one for the stop
- * time.
+ * A Timer combines two readings of a clock, one for the start time and one for
+ * the stop time. Both are taken from the clock given as template parameter,
+ * e.g. MonotonicClock, ThreadCpuClock or TscClock. The readings are kept in
+ * the raw unit of the clock and are converted to a Timestamp only when the
+ * duration is requested. Timer is the instantiation on MonotonicClock, which
+ * is not affected by changes of the system time.
  *
  * \attention This class is \b NOT reentrant and \b NOT thread-safe.
+ * \tparam Clock One of the clock policies defined in Clock.h.
  */
-class Timer {
+template<class Clock>
+class BasicTimer {
 public:
     /**
      * \brief Default constructor.
      *
-     * Creates two Timestamps which are set to zero.
+     * Creates a Timer whose clock readings are set to zero.
      */
-    Timer();
+    BasicTimer();
 
     /**
      * \brief Copy constructor.
@@ -66,14 +74,24 @@ public:
      * based on the stack, the both objects are fully independent.
      * @param orig
      */
-    Timer(const Timer& orig);
+    BasicTimer(const BasicTimer& orig);
+
+    /**
+     * \brief Creates a stopped Timer from two readings of its clock.
+     *
+     * The readings have to be in the raw unit of the clock, as returned by
+     * Clock::read(). This is used to convert from FastTimer.
+     * @param startTime
+     * @param stopTime
+     */
+    BasicTimer(const std::int64_t startTime, const std::int64_t stopTime);
 
     /**
      * \brief Standard destructor.
      *
      * Since all variables are on the stack, nothing is done here.
      */
-    virtual ~Timer();
+    virtual ~BasicTimer();
 
     /**
      * \brief Start the timer.
@@ -96,19 +114,66 @@ public:
      */
     void stop();
 
+    /**
+     * \brief Starts the Timer with a reading taken before.
+     *
+     * Like start(), but uses the given reading of the clock instead of reading
+     * it again. Many Timer can be started with a single reading this way.
+     * @param reading A reading of Clock::read()
+     */
+    void startAt(std::int64_t reading);
+
+    /**
+     * \brief Stops the Timer with a reading taken before.
+     *
+     * Like stop(), but uses the given reading of the clock instead of reading
+     * it again. A paused Timer is stopped at its pause, as with stop().
+     * @param reading A reading of Clock::read()
+     */
+    void stopAt(std::int64_t reading);
+
+    /**
+     * \brief Pause a running timer.
+     *
+     * The time until resume() is called is not part of the duration. A Timer
+     * can be paused and resumed any number of times without allocating
+     * anything. If a paused Timer is stopped, it is stopped at the moment it
+     * has been paused.
+     *
+     * \attention This method fails silently. The user has to check if the
+     * timer is running and not paused already.
+     */
+    void pause();
+
+    /**
+     * \brief Resume a paused timer.
+     *
+     * \attention This method fails silently. The user has to check if the
+     * timer is paused.
+     */
+    void resume();
+
     /**
      * \brief Reset the timer.
      *
      * This method resets the timer. It will reset every timer, whether is
-     * running or not.
+     * running or not. Derived timers reset their own state as well.
      */
-    void reset();
+    virtual void reset();
 
     /**
      * \brief Return if the timer is running.
+     *
+     * A paused Timer is still regarded as running, since it has not been
+     * stopped.
      */
     bool isRunning() const;
 
+    /**
+     * \brief Return if the timer is paused.
+     */
+    bool isPaused() const;
+
 
     /**
      * \brief Return if the timer is reset.
@@ -120,12 +185,36 @@ public:
      *
      * This method returns a Timestamp object holding the duration of the timer.
      * If the timer is running, this means the time elapsed from the start of
-     * this Timer upto now. The Timer keeps on running.
+     * this Timer upto now. The Timer keeps on running. Paused time is not
+     * included. If the bias subtraction of the Calibration is enabled, the
+     * overhead of reading the clock is subtracted.
      *
      * \attention This does not stop the Timer.
      */
     const Timestamp getTime() const;
 
+    /**
+     * \brief Returns the duration in the raw unit of the clock.
+     *
+     * This is the duration returned by getTime() before the conversion to a
+     * Timestamp and without subtracting the overhead of reading the clock.
+     */
+    std::int64_t getElapsedTicks() const;
+
+    /**
+     * \brief Returns the raw clock reading taken by start().
+     *
+     * Returns 0, if the Timer is reset.
+     */
+    std::int64_t getStartTicks() const;
+
+    /**
+     * \brief Returns the raw clock reading taken by stop().
+     *
+     * Returns 0, if the Timer has not been stopped.
+     */
+    std::int64_t getStopTicks() const;
+
     /**
      * \brief Returns the elapsed time in seconds
      *
@@ -161,12 +250,12 @@ public:
     /**
      * \brief Assign the values of the other Timer to this object
      *
-     * This method assigns the values of the Timestamps to this Timer. Also the
-     * state of running. Afterwards both Timer are completely independent, since
-     * all the variables are hold on the stack.
+     * This method assigns the clock readings to this Timer. Also the state of
+     * running. Afterwards both Timer are completely independent, since all the
+     * variables are hold on the stack.
      * @param rhs
      */
-    Timer& operator=(const Timer& rhs);
+    BasicTimer& operator=(const BasicTimer& rhs);
 
     /**
      * \brief Returns the sum of durations.
@@ -175,7 +264,7 @@ public:
      * Timestamp.
      * @param rhs
      */
-    const Timestamp operator+(const Timer& rhs) const;
+    const Timestamp operator+(const BasicTimer& rhs) const;
 
     /**
      * \brief Returns the difference of durations.
@@ -184,7 +273,7 @@ public:
      * as an Timestamp.
      * @param rhs
      */
-    const Timestamp operator-(const Timer& rhs) const;
+    const Timestamp operator-(const BasicTimer& rhs) const;
 
     /**
      * This operator is deleted since it makes no sense.
@@ -193,7 +282,7 @@ public:
      * not meaningful to add the second to the first one.
      * @param rhs
      */
-    Timer operator+=(const Timer& rhs) = delete;
+    BasicTimer operator+=(const BasicTimer& rhs) = delete;
 
     /**
      * This operator is deleted since it makes no sense.
@@ -202,21 +291,21 @@ public:
      * not meaningful to subtract the second to the first one.
      * @param rhs
      */
-    Timer operator-=(const Timer& rhs) = delete;
+    BasicTimer operator-=(const BasicTimer& rhs) = delete;
 
     /**
      * \brief Checks for equality of duration
      *
      * This method first checks if the objects are the same. If not, the
      * duration of both Timers are checked whether they differ significantly or
-     * not. Since double precision variables tend to be inaccurate in the last
-     * digits of its fractional part. Therefore they are not checked for
-     * equality but if they differ in the margin of error. I assume an error
-     * margin of 10e-08 is suitable. You can adjust this with the macro
-     * HRTPP_ERROR_MARGIN
+     * not. The durations are compared as integral nanoseconds, but are
+     * regarded as equal if they differ by no more than the margin of error.
+     * I assume an error margin of 10e-08 seconds is suitable. You can adjust
+     * this with the macro HRTPP_ERROR_MARGIN, which is given in seconds and
+     * rounded to nanoseconds. Set it to 0 for exact comparisons.
      * @param rhs
      */
-    bool operator==(const Timer& rhs) const;
+    bool operator==(const BasicTimer& rhs) const;
 
     /**
      * \brief Checks for inequality of duration
@@ -224,33 +313,33 @@ public:
      * This is the opposite of the check for equality.
      * @param rhs
      */
-    bool operator!=(const Timer& rhs) const;
+    bool operator!=(const BasicTimer& rhs) const;
 
     /**
      * \brief Checks whether this Timer has a bigger or equal duration as the
      * other.
      * @param rhs
      */
-    bool operator>=(const Timer& rhs) const;
+    bool operator>=(const BasicTimer& rhs) const;
 
     /**
      * \brief Checks whether this Timer has a bigger duration as the other.
      * @param rhs
      */
-    bool operator>(const Timer& rhs) const;
+    bool operator>(const BasicTimer& rhs) const;
 
     /**
      * \brief Checks whether this Timer has a smaller or equal duration as the
      * other.
      * @param rhs
      */
-    bool operator<=(const Timer& rhs) const;
+    bool operator<=(const BasicTimer& rhs) const;
 
     /**
      * \brief Checks whether this Timer has a bigger duration as the other.
      * @param rhs
      */
-    bool operator<(const Timer& rhs) const;
+    bool operator<(const BasicTimer& rhs) const;
 
     /**
      * \brief Checks for the equality of the duration and start ans stop times.
@@ -259,7 +348,7 @@ public:
      * if the start time and the stop time is the same.
      * @param rhs
      */
-    bool isEqual(const Timer& rhs) const;
+    bool isEqual(const BasicTimer& rhs) const;
 
     /**
      * \brief Returns the frequency resulting from the time measured.
@@ -269,13 +358,27 @@ public:
      */
     double getFrequency() const;
 
+    /**
+     * \brief Returns the resolution of the clock used by this Timer.
+     */
+    static Timestamp getResolution();
+
 private:
-    Timestamp mStartTime, mStopTime;
+    std::int64_t getDifference(const BasicTimer& rhs) const;
+
+    std::int64_t mStartTime, mStopTime;
+    std::int64_t mPauseTime, mPausedTicks;
 
     bool mIsRunning;
     bool mIsReset;
+    bool mIsPaused;
 
 };
 
+/**
+ * \brief The default Timer, measuring with the monotonic clock.
+ */
+typedef BasicTimer<MonotonicClock> Timer;
+
 #endif	/* TIMER_H */
 
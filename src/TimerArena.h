@@ -0,0 +1,359 @@
+/*
+ * File:   TimerArena.h
+ * Author: Nils Döring
+ *
+ * Created on October 20, 2026, 10:10 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef TIMERARENA_H
+#define	TIMERARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief This class allocates Timer in large slabs of memory.
+ *
+ * A TimerArena is the default allocator of Timerseries. Creating a Timer moves
+ * a pointer within the current slab, so there is a call of the global
+ * allocator only once per slab. Every slab is twice as large as the previous
+ * one. A Timer given back with destroy() leaves a hole, which the next
+ * create() fills. reset() destroys all Timer and reuses the slabs for the next
+ * Timer, nothing is freed before the arena is destroyed.
+ *
+ * An allocator for Timerseries has to provide the methods of this class:
+ * create() and create(const T&) to construct a Timer, destroy() to give back
+ * a single Timer, owns() to recognise its Timer and reset() to destroy all of
+ * them.
+ *
+ * \attention This class is \b NOT reentrant and \b NOT thread-safe.
+ * \tparam T The type of the Timer.
+ */
+template<class T>
+class TimerArena {
+public:
+    /**
+     * \brief The number of Timer in the first slab.
+     */
+    static const std::size_t FIRST_SLAB_SIZE = 64;
+
+    /**
+     * \brief Default constructor.
+     *
+     * Creates an arena without any slab. The first slab is allocated by the
+     * first call of create().
+     */
+    TimerArena() :
+        mSlabs(),
+        mCurrentSlab(0),
+        mUsed(0),
+        mFree() {
+    }
+
+    /**
+     * \brief Copy constructor.
+     *
+     * This is deleted, since the Timer cannot change their arena.
+     */
+    TimerArena(const TimerArena& orig) = delete;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * This is deleted, since the Timer cannot change their arena.
+     */
+    TimerArena& operator=(const TimerArena& rhs) = delete;
+
+    /**
+     * \brief Move constructor.
+     *
+     * Takes over the slabs of orig, so the Timer keep their addresses. orig is
+     * empty afterwards.
+     * @param orig
+     */
+    TimerArena(TimerArena&& orig) :
+        mSlabs(std::move(orig.mSlabs)),
+        mCurrentSlab(orig.mCurrentSlab),
+        mUsed(orig.mUsed),
+        mFree(std::move(orig.mFree)) {
+        orig.mSlabs.clear();
+        orig.mCurrentSlab = 0;
+        orig.mUsed = 0;
+        orig.mFree.clear();
+    }
+
+    /**
+     * \brief Move assignment operator.
+     *
+     * Destroys the Timer of this arena and takes over the slabs of rhs.
+     * @param rhs
+     */
+    TimerArena& operator=(TimerArena&& rhs) {
+        if(this != &rhs) {
+            this->release();
+
+            this->mSlabs = std::move(rhs.mSlabs);
+            this->mCurrentSlab = rhs.mCurrentSlab;
+            this->mUsed = rhs.mUsed;
+            this->mFree = std::move(rhs.mFree);
+
+            rhs.mSlabs.clear();
+            rhs.mCurrentSlab = 0;
+            rhs.mUsed = 0;
+            rhs.mFree.clear();
+        }
+
+        return *this;
+    }
+
+    /**
+     * \brief Destroys all Timer and frees the slabs.
+     */
+    ~TimerArena() {
+        this->release();
+    }
+
+    /**
+     * \brief Creates a new Timer with the default constructor.
+     *
+     * The memory of the Timer given back last is reused first.
+     */
+    T* create() {
+        T* object = this->allocate();
+
+        try {
+            new (object) T();
+        } catch(...) {
+            this->deallocate(object);
+            throw;
+        }
+
+        return object;
+    }
+
+    /**
+     * \brief Creates a copy of the given Timer.
+     * @param orig
+     */
+    T* create(const T& orig) {
+        T* object = this->allocate();
+
+        try {
+            new (object) T(orig);
+        } catch(...) {
+            this->deallocate(object);
+            throw;
+        }
+
+        return object;
+    }
+
+    /**
+     * \brief Destroys a single Timer and gives back its memory.
+     *
+     * The memory is reused by the next create(), so a series removing and
+     * adding Timer does not grow.
+     * @param object
+     */
+    void destroy(T* object) {
+        object->T::~T();
+        this->mFree.push_back(object);
+    }
+
+    /**
+     * \brief Checks whether the Timer has been created by this arena.
+     *
+     * This scans the slabs, which takes logarithmic time in the number of
+     * created Timer, since the slabs grow exponentially. Checking every Timer
+     * of a series thus takes O(n log n).
+     * @param object
+     */
+    bool owns(const T* object) const {
+        std::less<const T*> less;
+
+        for(std::size_t i = 0; i < this->mSlabs.size()
+                and i <= this->mCurrentSlab; ++i) {
+            const T* begin = this->mSlabs[i].mObjects;
+            const T* end = begin + this->getUsed(i);
+
+            if(!less(object, begin) and less(object, end)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * \brief Destroys all Timer and starts again with the first slab.
+     *
+     * If T is trivially destructible, this takes constant time. Otherwise the
+     * destructor of each Timer is called, which takes linear time in the
+     * number of created Timer. The Timer of this library have virtual
+     * destructors, but the calls are not virtual and inlined to nothing. Timer
+     * given back with destroy() are skipped by a binary search, which adds a
+     * logarithmic factor in their number.
+     */
+    void reset() {
+        if(!std::is_trivially_destructible<T>::value) {
+            std::less<const T*> less;
+
+            std::sort(this->mFree.begin(), this->mFree.end(), less);
+
+            for(std::size_t i = 0; i < this->mSlabs.size()
+                    and i <= this->mCurrentSlab; ++i) {
+                T* objects = this->mSlabs[i].mObjects;
+                std::size_t used = this->getUsed(i);
+
+                for(std::size_t j = 0; j < used; ++j) {
+                    if(this->mFree.empty()
+                            or !std::binary_search(this->mFree.begin(),
+                                this->mFree.end(), &objects[j], less)) {
+                        objects[j].T::~T();
+                    }
+                }
+            }
+        }
+
+        this->mCurrentSlab = 0;
+        this->mUsed = 0;
+        this->mFree.clear();
+    }
+
+    /**
+     * \brief Returns the number of Timer created and not given back since the
+     * last reset().
+     */
+    std::size_t getSize() const {
+        std::size_t size = 0;
+
+        for(std::size_t i = 0; i < this->mSlabs.size()
+                and i <= this->mCurrentSlab; ++i) {
+            size += this->getUsed(i);
+        }
+
+        return size - this->mFree.size();
+    }
+
+    /**
+     * \brief Returns the number of Timer that fit into all slabs.
+     */
+    std::size_t getCapacity() const {
+        std::size_t capacity = 0;
+
+        for(const Slab& slab: this->mSlabs) {
+            capacity += slab.mCapacity;
+        }
+
+        return capacity;
+    }
+
+private:
+    struct Slab {
+        T* mObjects;
+        std::size_t mCapacity;
+    };
+
+    /* the slabs before the current one are full */
+    std::size_t getUsed(std::size_t slab) const {
+        return slab < this->mCurrentSlab ? this->mSlabs[slab].mCapacity
+            : this->mUsed;
+    }
+
+    /* destroy all Timer and free the slabs */
+    void release() {
+        this->reset();
+
+        for(Slab& slab: this->mSlabs) {
+            ::operator delete(slab.mObjects);
+        }
+
+        this->mSlabs.clear();
+    }
+
+    /* reuse the memory of a destroyed Timer, or move on to the next slab, if
+     * the current one is full */
+    T* allocate() {
+        if(!this->mFree.empty()) {
+            T* object = this->mFree.back();
+
+            this->mFree.pop_back();
+
+            return object;
+        }
+
+        if(this->mSlabs.empty()
+                or this->mUsed == this->mSlabs[this->mCurrentSlab].mCapacity) {
+            if(!this->mSlabs.empty()
+                    and this->mCurrentSlab + 1 < this->mSlabs.size()) {
+                ++(this->mCurrentSlab);
+            } else {
+                std::size_t capacity = this->mSlabs.empty() ? FIRST_SLAB_SIZE
+                    : 2 * this->mSlabs.back().mCapacity;
+                Slab slab;
+
+                this->mSlabs.reserve(this->mSlabs.size() + 1);
+                slab.mObjects =
+                    static_cast<T*>(::operator new(capacity * sizeof(T)));
+                slab.mCapacity = capacity;
+
+                this->mSlabs.push_back(slab);
+                this->mCurrentSlab = this->mSlabs.size() - 1;
+            }
+
+            this->mUsed = 0;
+        }
+
+        return &(this->mSlabs[this->mCurrentSlab].mObjects[(this->mUsed)++]);
+    }
+
+    /* give back the memory of a Timer whose constructor has thrown */
+    void deallocate(T* object) {
+        this->mFree.push_back(object);
+    }
+
+    std::vector<Slab> mSlabs;
+    std::size_t mCurrentSlab;
+    std::size_t mUsed;
+    /* the memory of destroyed Timer, reused before the slabs */
+    std::vector<T*> mFree;
+};
+
+template<class T>
+const std::size_t TimerArena<T>::FIRST_SLAB_SIZE;
+
+#endif	/* TIMERARENA_H */
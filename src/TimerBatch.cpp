@@ -0,0 +1,217 @@
+/*
+ * File:   TimerBatch.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 20, 2026, 2:10 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "TimerBatch.h"
+#include "Calibration.h"
+
+template<class Clock>
+const std::int64_t BasicTimerBatch<Clock>::RUNNING;
+
+/*
+ * Creates a batch without any measurements.
+ */
+template<class Clock>
+BasicTimerBatch<Clock>::BasicTimerBatch() : mStartTimes(), mStopTimes() {
+}
+
+/*
+ * Nothing to clean up.
+ */
+template<class Clock>
+BasicTimerBatch<Clock>::~BasicTimerBatch() {
+}
+
+/*
+ * The clock is read after growing the arrays, so the allocation is not part of
+ * the measurements.
+ */
+template<class Clock>
+std::size_t BasicTimerBatch<Clock>::start(std::size_t count) {
+    std::size_t first = this->mStartTimes.size();
+
+    this->mStartTimes.resize(first + count);
+    this->mStopTimes.resize(first + count, RUNNING);
+
+    std::int64_t reading = Clock::read();
+    std::int64_t* startTimes = this->mStartTimes.data() + first;
+
+    for(std::size_t i = 0; i < count; ++i) {
+        startTimes[i] = reading;
+    }
+
+    return first;
+}
+
+/*
+ * Only a running measurement is stopped.
+ */
+template<class Clock>
+void BasicTimerBatch<Clock>::stop(std::size_t index) {
+    if(this->mStopTimes[index] == RUNNING) {
+        this->mStopTimes[index] = Clock::read();
+    }
+}
+
+/*
+ * Reads the clock once for all indices.
+ */
+template<class Clock>
+void BasicTimerBatch<Clock>::stop(const std::size_t* indices,
+        std::size_t count) {
+    std::int64_t reading = Clock::read();
+    std::int64_t* stopTimes = this->mStopTimes.data();
+
+    for(std::size_t i = 0; i < count; ++i) {
+        std::int64_t& stopTime = stopTimes[indices[i]];
+
+        if(stopTime == RUNNING) {
+            stopTime = reading;
+        }
+    }
+}
+
+/*
+ * The loop has no branch, it selects the reading or keeps the stop time, so
+ * it can be vectorised.
+ */
+template<class Clock>
+void BasicTimerBatch<Clock>::stopAll() {
+    std::int64_t reading = Clock::read();
+    std::int64_t* stopTimes = this->mStopTimes.data();
+    std::size_t size = this->mStopTimes.size();
+
+    for(std::size_t i = 0; i < size; ++i) {
+        stopTimes[i] = (stopTimes[i] == RUNNING) ? reading : stopTimes[i];
+    }
+}
+
+/*
+ * A measurement is running until its stop reading is set.
+ */
+template<class Clock>
+bool BasicTimerBatch<Clock>::isRunning(std::size_t index) const {
+    return this->mStopTimes[index] == RUNNING;
+}
+
+/*
+ * A running measurement is returned as a reset Timer.
+ */
+template<class Clock>
+BasicTimer<Clock> BasicTimerBatch<Clock>::getTimer(std::size_t index) const {
+    if(this->isRunning(index)) {
+        return BasicTimer<Clock>();
+    }
+
+    return BasicTimer<Clock>(this->mStartTimes[index],
+        this->mStopTimes[index]);
+}
+
+/*
+ * Corrects the ticks by the overhead of reading the clock, like Timer does. A
+ * running measurement has no stop reading yet.
+ */
+template<class Clock>
+const Timestamp BasicTimerBatch<Clock>::getTime(std::size_t index) const {
+    if(this->isRunning(index)) {
+        return Clock::toTimestamp(0);
+    }
+
+    std::int64_t ticks = Calibration<Clock>::correct(
+        this->mStopTimes[index] - this->mStartTimes[index]);
+
+    return Clock::toTimestamp(ticks);
+}
+
+/*
+ * Skips the running measurements.
+ */
+template<class Clock>
+std::size_t BasicTimerBatch<Clock>::appendTo(
+        BasicContiguousTimerseries<Clock>& series) const {
+    std::size_t size = this->mStartTimes.size();
+    std::size_t count = 0;
+
+    for(std::size_t i = 0; i < size; ++i) {
+        if(this->mStopTimes[i] != RUNNING) {
+            series.append(this->mStartTimes[i], this->mStopTimes[i]);
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/*
+ * Clearing a vector keeps its capacity.
+ */
+template<class Clock>
+void BasicTimerBatch<Clock>::clear() {
+    this->mStartTimes.clear();
+    this->mStopTimes.clear();
+}
+
+/*
+ * Returns the number of measurements.
+ */
+template<class Clock>
+std::size_t BasicTimerBatch<Clock>::getSize() const {
+    return this->mStartTimes.size();
+}
+
+/*
+ * Returns the array of start readings.
+ */
+template<class Clock>
+const std::int64_t* BasicTimerBatch<Clock>::getStartTimes() const {
+    return this->mStartTimes.data();
+}
+
+/*
+ * Returns the array of stop readings.
+ */
+template<class Clock>
+const std::int64_t* BasicTimerBatch<Clock>::getStopTimes() const {
+    return this->mStopTimes.data();
+}
+
+template class BasicTimerBatch<RealtimeClock>;
+template class BasicTimerBatch<MonotonicClock>;
+template class BasicTimerBatch<MonotonicRawClock>;
+template class BasicTimerBatch<BoottimeClock>;
+template class BasicTimerBatch<ProcessCpuClock>;
+template class BasicTimerBatch<ThreadCpuClock>;
+template class BasicTimerBatch<TscClock>;
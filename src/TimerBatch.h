@@ -0,0 +1,185 @@
+/*
+ * File:   TimerBatch.h
+ * Author: Nils Döring
+ *
+ * Created on October 20, 2026, 2:10 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef TIMERBATCH_H
+#define	TIMERBATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "Timestamp.h"
+#include "Clock.h"
+#include "Timer.h"
+#include "ContiguousTimerseries.h"
+
+/**
+ * \brief This class starts and stops many measurements with a single reading
+ * of the clock.
+ *
+ * The readings are stored in two arrays like in ContiguousTimerseries. Each
+ * measurement is identified by its index, the handle returned by start().
+ * Stamping many measurements is a loop over an array with one reading, which
+ * the compiler can vectorise, and all of them get exactly the same time. This
+ * is meant for fan-out and fan-in, e.g. starting a request to many servers and
+ * stopping each one when its answer arrives:
+ * \code
+ * TimerBatch batch;
+ * std::size_t first = batch.start(servers);
+ * ...
+ * batch.stop(answered, count);  // the indices of all answers received
+ * ...
+ * batch.stopAll();  // the remaining ones timed out
+ * batch.appendTo(series);
+ * \endcode
+ *
+ * \attention This class is not thread-safe.
+ * \tparam Clock One of the clock policies defined in Clock.h.
+ */
+template<class Clock>
+class BasicTimerBatch {
+public:
+    /**
+     * \brief The stop reading of a measurement that is still running.
+     *
+     * No clock returns this reading, unlike 0, which e.g. the CPU time clocks
+     * may return.
+     */
+    static const std::int64_t RUNNING =
+        std::numeric_limits<std::int64_t>::min();
+
+    /**
+     * \brief Default constructor.
+     */
+    BasicTimerBatch();
+
+    /**
+     * \brief Destructor.
+     */
+    virtual ~BasicTimerBatch();
+
+    /**
+     * \brief Starts count new measurements with a single reading of the clock.
+     *
+     * Returns the index of the first one, the others follow it.
+     * @param count
+     */
+    std::size_t start(std::size_t count);
+
+    /**
+     * \brief Stops the measurement of the index, if it is running.
+     * @param index
+     */
+    void stop(std::size_t index);
+
+    /**
+     * \brief Stops the measurements of the given indices with a single
+     * reading of the clock.
+     *
+     * Measurements that have already been stopped are left unchanged.
+     * @param indices
+     * @param count The number of indices
+     */
+    void stop(const std::size_t* indices, std::size_t count);
+
+    /**
+     * \brief Stops all running measurements with a single reading of the
+     * clock.
+     */
+    void stopAll();
+
+    /**
+     * \brief Checks whether the measurement of the index is running.
+     * @param index
+     */
+    bool isRunning(std::size_t index) const;
+
+    /**
+     * \brief Returns the measurement of the index as a Timer.
+     *
+     * The Timer is only set, if the measurement has been stopped. Otherwise it
+     * is reset.
+     * @param index
+     */
+    BasicTimer<Clock> getTimer(std::size_t index) const;
+
+    /**
+     * \brief Returns the duration of the stopped measurement of the index.
+     *
+     * Returns zero, if the measurement is still running.
+     * @param index
+     */
+    const Timestamp getTime(std::size_t index) const;
+
+    /**
+     * \brief Appends all stopped measurements to the series.
+     *
+     * Returns the number of appended measurements.
+     * @param series
+     */
+    std::size_t appendTo(BasicContiguousTimerseries<Clock>& series) const;
+
+    /**
+     * \brief Removes all measurements, but keeps the allocated memory.
+     */
+    void clear();
+
+    /**
+     * \brief Returns the number of measurements, running or stopped.
+     */
+    std::size_t getSize() const;
+
+    /**
+     * \brief Returns the start readings of all measurements.
+     */
+    const std::int64_t* getStartTimes() const;
+
+    /**
+     * \brief Returns the stop readings of all measurements.
+     *
+     * Running measurements have the stop reading RUNNING.
+     */
+    const std::int64_t* getStopTimes() const;
+
+private:
+    std::vector<std::int64_t> mStartTimes;
+    std::vector<std::int64_t> mStopTimes;
+};
+
+typedef BasicTimerBatch<MonotonicClock> TimerBatch;
+
+#endif	/* TIMERBATCH_H */
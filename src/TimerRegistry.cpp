@@ -0,0 +1,286 @@
+/*
+ * File:   TimerRegistry.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 20, 2026, 9:40 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "TimerRegistry.h"
+
+#include <stdexcept>
+
+/*
+ * Allocates all entries up front, the series are created when a name is
+ * interned.
+ */
+template<class Clock>
+BasicTimerRegistry<Clock>::BasicTimerRegistry(std::size_t capacity) :
+        mEntries(new Entry[capacity]),
+        mCapacity(capacity),
+        mSize(0),
+        mHandles(),
+        mMutex() {
+}
+
+/*
+ * Deletes all series and the entries.
+ */
+template<class Clock>
+BasicTimerRegistry<Clock>::~BasicTimerRegistry() {
+    std::size_t size = this->mSize.load(std::memory_order_relaxed);
+
+    for(std::size_t i = 0; i < size; ++i) {
+        delete this->mEntries[i].mSeries;
+    }
+
+    delete[] this->mEntries;
+}
+
+/*
+ * The entry is complete before the new size is published, so a thread that
+ * sees the size can use the entry without a lock.
+ */
+template<class Clock>
+typename BasicTimerRegistry<Clock>::Handle
+BasicTimerRegistry<Clock>::intern(const std::string& name) {
+    std::lock_guard<std::mutex> lock(this->mMutex);
+    typename std::unordered_map<std::string, Handle>::const_iterator it =
+        this->mHandles.find(name);
+
+    if(it != this->mHandles.end()) {
+        return it->second;
+    }
+
+    std::size_t size = this->mSize.load(std::memory_order_relaxed);
+
+    if(size == this->mCapacity) {
+        throw std::length_error("TimerRegistry is full");
+    }
+
+    Entry& entry = this->mEntries[size];
+    entry.mName = name;
+    entry.mSeries = new BasicShardedTimerseries<Clock>();
+
+    Handle handle = static_cast<Handle>(size);
+    this->mHandles[name] = handle;
+    this->mSize.store(size + 1, std::memory_order_release);
+
+    return handle;
+}
+
+/*
+ * Looks the name up in the map of interned names.
+ */
+template<class Clock>
+bool BasicTimerRegistry<Clock>::find(const std::string& name,
+        Handle& handle) const {
+    std::lock_guard<std::mutex> lock(this->mMutex);
+    typename std::unordered_map<std::string, Handle>::const_iterator it =
+        this->mHandles.find(name);
+
+    if(it == this->mHandles.end()) {
+        return false;
+    }
+
+    handle = it->second;
+
+    return true;
+}
+
+/*
+ * Compares the beginning of every name with the prefix.
+ */
+template<class Clock>
+std::vector<typename BasicTimerRegistry<Clock>::Handle>
+BasicTimerRegistry<Clock>::getHandles(const std::string& prefix) const {
+    std::vector<Handle> handles;
+    std::size_t size = this->getSize();
+
+    for(std::size_t i = 0; i < size; ++i) {
+        if(this->mEntries[i].mName.compare(0, prefix.size(), prefix) == 0) {
+            handles.push_back(static_cast<Handle>(i));
+        }
+    }
+
+    return handles;
+}
+
+/*
+ * The name of an entry never changes.
+ */
+template<class Clock>
+const std::string& BasicTimerRegistry<Clock>::getName(Handle handle) const {
+    return this->mEntries[handle].mName;
+}
+
+/*
+ * Returns the series of the entry.
+ */
+template<class Clock>
+BasicShardedTimerseries<Clock>&
+BasicTimerRegistry<Clock>::getSeries(Handle handle) {
+    return *this->mEntries[handle].mSeries;
+}
+
+/*
+ * Returns the series of the entry.
+ */
+template<class Clock>
+const BasicShardedTimerseries<Clock>&
+BasicTimerRegistry<Clock>::getSeries(Handle handle) const {
+    return *this->mEntries[handle].mSeries;
+}
+
+/*
+ * Appends the Timer to the series of the handle.
+ */
+template<class Clock>
+void BasicTimerRegistry<Clock>::record(Handle handle,
+        const BasicTimer<Clock>& timer) {
+    *this->mEntries[handle].mSeries += timer;
+}
+
+/*
+ * Appends the FastTimer to the series of the handle.
+ */
+template<class Clock>
+void BasicTimerRegistry<Clock>::record(Handle handle,
+        const BasicFastTimer<Clock>& timer) {
+    *this->mEntries[handle].mSeries += timer;
+}
+
+/*
+ * Appends both readings to the series of the handle.
+ */
+template<class Clock>
+void BasicTimerRegistry<Clock>::record(Handle handle, std::int64_t startTime,
+        std::int64_t stopTime) {
+    this->mEntries[handle].mSeries->append(startTime, stopTime);
+}
+
+/*
+ * Merges the shards of the series and computes the Statistic from a view on
+ * the merged readings.
+ */
+template<class Clock>
+Statistic* BasicTimerRegistry<Clock>::getStatistic(Handle handle,
+        typename ReadingsView<Clock>::Unit unit) const {
+    BasicContiguousTimerseries<Clock> series;
+
+    this->mEntries[handle].mSeries->snapshot(series);
+
+    ReadingsView<Clock> view = series.view(unit);
+
+    return new Statistic(view.begin(), view.end());
+}
+
+/*
+ * The snapshots are taken under the lock, which keeps intern() and clear()
+ * out. The statistics are computed after releasing it.
+ */
+template<class Clock>
+std::map<std::string, Statistic*>* BasicTimerRegistry<Clock>::getStatistics(
+        typename ReadingsView<Clock>::Unit unit) const {
+    std::vector<BasicContiguousTimerseries<Clock> > snapshots;
+    std::size_t size;
+
+    {
+        std::lock_guard<std::mutex> lock(this->mMutex);
+        size = this->mSize.load(std::memory_order_relaxed);
+        snapshots.resize(size);
+
+        for(std::size_t i = 0; i < size; ++i) {
+            this->mEntries[i].mSeries->snapshot(snapshots[i]);
+        }
+    }
+
+    std::map<std::string, Statistic*>* statistics =
+        new std::map<std::string, Statistic*>();
+
+    for(std::size_t i = 0; i < size; ++i) {
+        ReadingsView<Clock> view = snapshots[i].view(unit);
+
+        (*statistics)[this->mEntries[i].mName] =
+            new Statistic(view.begin(), view.end());
+    }
+
+    return statistics;
+}
+
+/*
+ * Clears every series under the lock, so no snapshot sees a partly cleared
+ * registry.
+ */
+template<class Clock>
+void BasicTimerRegistry<Clock>::clear() {
+    std::lock_guard<std::mutex> lock(this->mMutex);
+    std::size_t size = this->mSize.load(std::memory_order_relaxed);
+
+    for(std::size_t i = 0; i < size; ++i) {
+        this->mEntries[i].mSeries->clear();
+    }
+}
+
+/*
+ * Returns the number of entries published so far.
+ */
+template<class Clock>
+std::size_t BasicTimerRegistry<Clock>::getSize() const {
+    return this->mSize.load(std::memory_order_acquire);
+}
+
+/*
+ * Returns the number of entries allocated.
+ */
+template<class Clock>
+std::size_t BasicTimerRegistry<Clock>::getCapacity() const {
+    return this->mCapacity;
+}
+
+/*
+ * A function-local static is initialised on first use and thread-safely.
+ */
+template<class Clock>
+BasicTimerRegistry<Clock>& BasicTimerRegistry<Clock>::getGlobal() {
+    static BasicTimerRegistry registry;
+
+    return registry;
+}
+
+template class BasicTimerRegistry<RealtimeClock>;
+template class BasicTimerRegistry<MonotonicClock>;
+template class BasicTimerRegistry<MonotonicRawClock>;
+template class BasicTimerRegistry<BoottimeClock>;
+template class BasicTimerRegistry<ProcessCpuClock>;
+template class BasicTimerRegistry<ThreadCpuClock>;
+template class BasicTimerRegistry<TscClock>;
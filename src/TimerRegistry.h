@@ -0,0 +1,244 @@
+/*
+ * File:   TimerRegistry.h
+ * Author: Nils Döring
+ *
+ * Created on October 20, 2026, 9:40 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef TIMERREGISTRY_H
+#define	TIMERREGISTRY_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Clock.h"
+#include "Timer.h"
+#include "FastTimer.h"
+#include "ShardedTimerseries.h"
+#include "Statistic.h"
+#include "TimeView.h"
+
+/**
+ * \brief This class holds a series of measurements for each timer name.
+ *
+ * A name such as "db.query.select" is interned once into a Handle, a small
+ * integer. Recording by Handle is an index into an array of
+ * ShardedTimerseries, so the name is neither hashed nor compared on the hot
+ * path. Names can be interned during static initialisation:
+ * \code
+ * static const TimerRegistry::Handle SELECT =
+ *     TimerRegistry::getGlobal().intern("db.query.select");
+ * ...
+ * TimerRegistry::getGlobal().record(SELECT, timer);
+ * \endcode
+ *
+ * The handles of a registry are numbered from 0 to getSize() - 1, so all
+ * series can be enumerated for reporting.
+ *
+ * \attention Interning, recording and snapshots are thread-safe. clear() and
+ * the destructor must not run while other threads record.
+ * \tparam Clock One of the clock policies defined in Clock.h.
+ */
+template<class Clock>
+class BasicTimerRegistry {
+public:
+    /**
+     * \brief The interned name of a series.
+     */
+    typedef std::uint32_t Handle;
+
+    /**
+     * \brief The number of names a registry holds by default.
+     */
+    static const std::size_t DEFAULT_CAPACITY = 1024;
+
+    /**
+     * \brief Constructs an empty registry for capacity names.
+     *
+     * The capacity is fixed, so the series never move while they are
+     * recorded.
+     * @param capacity
+     */
+    BasicTimerRegistry(std::size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * \brief The series are shared by all users of the handles, so a
+     * registry cannot be copied.
+     */
+    BasicTimerRegistry(const BasicTimerRegistry& orig) = delete;
+
+    /**
+     * \brief See the copy constructor.
+     */
+    BasicTimerRegistry& operator=(const BasicTimerRegistry& rhs) = delete;
+
+    /**
+     * \brief Destroys all series of this registry.
+     */
+    virtual ~BasicTimerRegistry();
+
+    /**
+     * \brief Returns the Handle of the name and registers it, if it is new.
+     *
+     * This takes a lock, so the Handle should be kept by the caller.
+     * \throws std::length_error if the registry is full.
+     * @param name
+     */
+    Handle intern(const std::string& name);
+
+    /**
+     * \brief Looks up the Handle of a registered name.
+     *
+     * Returns false, if the name has not been interned.
+     * @param name
+     * @param handle Set to the Handle of the name, if it is found
+     */
+    bool find(const std::string& name, Handle& handle) const;
+
+    /**
+     * \brief Returns the handles of all names starting with the prefix.
+     *
+     * With hierarchical names, "db.query." selects all queries.
+     * @param prefix
+     */
+    std::vector<Handle> getHandles(const std::string& prefix) const;
+
+    /**
+     * \brief Returns the name of the Handle.
+     * @param handle
+     */
+    const std::string& getName(Handle handle) const;
+
+    /**
+     * \brief Returns the series of the Handle.
+     * @param handle
+     */
+    BasicShardedTimerseries<Clock>& getSeries(Handle handle);
+
+    /**
+     * \brief Returns the series of the Handle.
+     * @param handle
+     */
+    const BasicShardedTimerseries<Clock>& getSeries(Handle handle) const;
+
+    /**
+     * \brief Records the measurement of the stopped Timer.
+     * @param handle
+     * @param timer
+     */
+    void record(Handle handle, const BasicTimer<Clock>& timer);
+
+    /**
+     * \brief Records the measurement of the FastTimer.
+     * @param handle
+     * @param timer
+     */
+    void record(Handle handle, const BasicFastTimer<Clock>& timer);
+
+    /**
+     * \brief Records a measurement given by two raw clock readings.
+     * @param handle
+     * @param startTime
+     * @param stopTime
+     */
+    void record(Handle handle, std::int64_t startTime, std::int64_t stopTime);
+
+    /**
+     * \brief Returns the Statistic of all measurements of the Handle.
+     *
+     * The caller has to delete the Statistic.
+     * @param handle
+     * @param unit The unit of the durations, e.g. ReadingsView::MICROSECONDS
+     */
+    Statistic* getStatistic(Handle handle,
+        typename ReadingsView<Clock>::Unit unit) const;
+
+    /**
+     * \brief Returns the Statistic of every series by name.
+     *
+     * All series are copied while no name can be registered and no series can
+     * be cleared. The statistics are computed afterwards. Measurements
+     * recorded meanwhile are part of the snapshot of their series or not. The
+     * caller has to delete the map and the Statistic objects.
+     * @param unit The unit of the durations, e.g. ReadingsView::MICROSECONDS
+     */
+    std::map<std::string, Statistic*>* getStatistics(
+        typename ReadingsView<Clock>::Unit unit) const;
+
+    /**
+     * \brief Removes all measurements, but keeps the names and handles.
+     */
+    void clear();
+
+    /**
+     * \brief Returns the number of registered names.
+     */
+    std::size_t getSize() const;
+
+    /**
+     * \brief Returns the maximum number of names.
+     */
+    std::size_t getCapacity() const;
+
+    /**
+     * \brief Returns the registry shared by the whole program.
+     *
+     * It is created on first use, so it can be used during static
+     * initialisation.
+     */
+    static BasicTimerRegistry& getGlobal();
+
+private:
+    struct Entry {
+        std::string mName;
+        BasicShardedTimerseries<Clock>* mSeries;
+    };
+
+    /* mEntries is allocated once. An entry is written before mSize is
+     * increased and never changed afterwards, so recording by handle needs
+     * no lock. */
+    Entry* mEntries;
+    std::size_t mCapacity;
+    std::atomic<std::size_t> mSize;
+    std::unordered_map<std::string, Handle> mHandles;
+    mutable std::mutex mMutex;
+};
+
+typedef BasicTimerRegistry<MonotonicClock> TimerRegistry;
+
+#endif	/* TIMERREGISTRY_H */
@@ -35,68 +35,217 @@
 
 
 #include "Timerseries.h"
+#include "CpuTimer.h"
+#include "ConcurrentTimer.h"
+#include "PerfTimer.h"
 
+#include <algorithm>
 #include <iostream>
+#include <utility>
+
+namespace {
+
+/*
+ * Equal Timer have equal start and stop readings of the wall clock. Sorting
+ * by these readings brings all candidates for Timer::isEqual() together.
+ */
+typedef std::pair<std::int64_t, std::int64_t> TimerKey;
+
+template<class Clock>
+TimerKey getTimerKey(const BasicTimer<Clock>& timer) {
+    return TimerKey(timer.getStartTicks(), timer.getStopTicks());
+}
+
+template<class Clock>
+TimerKey getTimerKey(const BasicCpuTimer<Clock>& timer) {
+    return getTimerKey(timer.getWallTimer());
+}
+
+template<class Clock>
+TimerKey getTimerKey(const BasicPerfTimer<Clock>& timer) {
+    return getTimerKey(timer.getTimer());
+}
+
+template<class Clock>
+TimerKey getTimerKey(const BasicConcurrentTimer<Clock>& timer) {
+    return TimerKey(timer.getStartTicks(), timer.getStopTicks());
+}
 
 /*
- * Creates a new object and stores the timers on the heap.
+ * Timer can be stopped with a reading taken before, the other timer types read
+ * their clocks themselves.
  */
-Timerseries::Timerseries() {
-    this->mTimer = new std::list<Timer*>();
+template<class Clock>
+void stopTimerAt(BasicTimer<Clock>& timer, std::int64_t reading) {
+    timer.stopAt(reading);
+}
+
+template<class TimerType>
+void stopTimerAt(TimerType& timer, std::int64_t) {
+    timer.stop();
 }
 
 /*
- * This copy-constructor uses the copy-constructor of the standard libraries
- * container to make a deep copy of all elements.
+ * Orders the entries of a TimerIndex by their key only.
  */
-Timerseries::Timerseries(const Timerseries& orig) {
-    this->mTimer = new std::list<Timer*>();
+struct TimerKeyLess {
+    template<class Entry>
+    bool operator()(const Entry& lhs, const TimerKey& rhs) const {
+        return lhs.first < rhs;
+    }
 
-    // for every Timer in origs series, push a copy to this list
-    for(const Timer* timer: *(orig.mTimer)){
-        this->mTimer->push_back(new Timer(*timer));
+    template<class Entry>
+    bool operator()(const TimerKey& lhs, const Entry& rhs) const {
+        return lhs < rhs.first;
     }
+
+    template<class Entry>
+    bool operator()(const Entry& lhs, const Entry& rhs) const {
+        return lhs.first < rhs.first;
+    }
+};
+
+/*
+ * The Timer of a series sorted by their keys. Each key is computed once.
+ */
+template<class TimerType>
+class TimerIndex {
+public:
+    typedef std::pair<TimerKey, const TimerType*> Entry;
+
+    TimerIndex(const std::vector<TimerType*>& timers) {
+        this->mEntries.reserve(timers.size());
+
+        for(const TimerType* timer: timers) {
+            this->mEntries.push_back(Entry(getTimerKey(*timer), timer));
+        }
+
+        std::sort(this->mEntries.begin(), this->mEntries.end(),
+            TimerKeyLess());
+    }
+
+    /*
+     * Counts the Timer equal to the given one, but stops counting at limit.
+     */
+    std::size_t countEqual(const TimerType& timer, std::size_t limit) const {
+        typedef typename std::vector<Entry>::const_iterator Iterator;
+        std::pair<Iterator, Iterator> range = std::equal_range(
+            this->mEntries.begin(), this->mEntries.end(),
+            getTimerKey(timer), TimerKeyLess());
+        std::size_t count = 0;
+
+        for(Iterator it = range.first; it != range.second and count < limit;
+                ++it) {
+            if(timer.isEqual(*it->second)) {
+                count++;
+            }
+        }
+
+        return count;
+    }
+
+    bool contains(const TimerType& timer) const {
+        return this->countEqual(timer, 1) > 0;
+    }
+
+private:
+    std::vector<Entry> mEntries;
+};
+
 }
 
 /*
- * This frees a lot of memory. Mind that all elements are destroyed, by calling
- * their destructor.
+ * Creates a new object without any Timer. The allocator allocates its memory
+ * with the first Timer.
  */
-Timerseries::~Timerseries() {
-    for(Timer* timer: *(this->mTimer)){
-        delete timer;
-        timer = nullptr;
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>::BasicTimerseries(
+        ) : mTimer(), mAllocator(), mAdoptedCount(0){
+}
+
+/*
+ * This copy-constructor creates a copy of every Timer with its own allocator,
+ * so both series are independent.
+ */
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>::BasicTimerseries(
+        const BasicTimerseries& orig) : BasicTimerseries() {
+    this->mTimer.reserve(orig.mTimer.size());
+
+    // for every Timer in origs series, push a copy to this series
+    for(const TimerType* timer: orig.mTimer){
+        this->mTimer.push_back(this->mAllocator.create(*timer));
     }
+}
+
+/*
+ * The move-constructor takes over the container and the allocator, so no Timer
+ * is copied or moved in memory.
+ */
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>::BasicTimerseries(
+        BasicTimerseries&& orig) :
+    mTimer(std::move(orig.mTimer)),
+    mAllocator(std::move(orig.mAllocator)),
+    mAdoptedCount(orig.mAdoptedCount) {
+    orig.mTimer.clear();
+    orig.mAdoptedCount = 0;
+}
 
-    delete this->mTimer;
+/*
+ * This frees a lot of memory. Mind that all elements are destroyed, by calling
+ * their destructor.
+ */
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>::~BasicTimerseries() {
+    this->deleteAllTimer();
 }
 
 /*
  * This assigns a copy from the rhs series to this series. All Timer stored in
  * this series are destroyed and freed.
  */
-Timerseries& Timerseries::operator =(const Timerseries& rhs) {
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>&
+BasicTimerseries<Clock, TimerType, Allocator>::operator =(
+        const BasicTimerseries& rhs) {
     if(this == &rhs) {  // the objects are the same
         return *this;
     }
 
     // delete the existing Timer
-    for(Timer* timer: *(this->mTimer)){
-        delete timer;
-        timer = nullptr;
-    }
+    this->deleteAllTimer();
 
-    // delete the list holding the Timer pointer
-    delete this->mTimer;
+    // make a copy for every Timer in the rhs series and store it in this series
+    this->mTimer.reserve(rhs.mTimer.size());
 
-    // create a new list
-    this->mTimer = new std::list<Timer*>();
+    for(const TimerType* timer: rhs.mTimer){
+        this->mTimer.push_back(this->mAllocator.create(*timer));
+    }
 
-    // make a copy for every Timer in the rhs series and store it in this series
-    for(const Timer* timer: *(rhs.mTimer)){
-        this->mTimer->push_back(new Timer(*timer));
+    return *this;
+}
+
+/*
+ * This destroys all Timer of this series and takes over the ones of rhs.
+ */
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>&
+BasicTimerseries<Clock, TimerType, Allocator>::operator =(
+        BasicTimerseries&& rhs) {
+    if(this == &rhs) {  // the objects are the same
+        return *this;
     }
 
+    this->deleteAllTimer();
+
+    this->mTimer = std::move(rhs.mTimer);
+    this->mAllocator = std::move(rhs.mAllocator);
+    this->mAdoptedCount = rhs.mAdoptedCount;
+
+    rhs.mTimer.clear();
+    rhs.mAdoptedCount = 0;
+
     return *this;
 }
 
@@ -105,10 +254,18 @@ Timerseries& Timerseries::operator =(const Timerseries& rhs) {
  * duplicates. If a Timer was duplicated and added to both lists, it will be
  * twize in this series.
  */
-Timerseries& Timerseries::operator +=(const Timerseries& rhs) {
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>&
+BasicTimerseries<Clock, TimerType, Allocator>::operator +=(
+        const BasicTimerseries& rhs) {
+    // the size is read first, since rhs can be this series
+    std::size_t size = rhs.mTimer.size();
+
+    this->mTimer.reserve(this->mTimer.size() + size);
+
     // make a copy for every Timer in the rhs series and store it in this series
-    for(const Timer* timer: *(rhs.mTimer)){
-        this->mTimer->push_back(new Timer(*timer));
+    for(std::size_t i = 0; i < size; ++i){
+        this->mTimer.push_back(this->mAllocator.create(*(rhs.mTimer[i])));
     }
 
     return *this;
@@ -118,49 +275,47 @@ Timerseries& Timerseries::operator +=(const Timerseries& rhs) {
  * Adds the given timer to this series. It will not be copied. If the series is
  * destroyed, it will destroy this timer as well.
  */
-Timerseries& Timerseries::operator +=(Timer* timerToAdd) {
-    this->mTimer->push_back( timerToAdd );
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>&
+BasicTimerseries<Clock, TimerType, Allocator>::operator +=(
+        TimerType* timerToAdd) {
+    this->mTimer.push_back( timerToAdd );
+    ++(this->mAdoptedCount);
 
     return *this;
 }
 
 /*
- * Removes every element from this series, that is present in rhs. Since every
- * combination has to be checked within the algorithm used at the moment, this
- * method takes O(n^2) time.
+ * Removes every element from this series, that is present in rhs. Only the
+ * Timer of rhs with the same readings are compared, which are found in the
+ * sorted index of rhs. The Timer are deleted after the comparison, since rhs
+ * can be this series.
  */
-Timerseries& Timerseries::operator -=(const Timerseries& rhs) {
-    std::list<Timer*>::iterator rhsIt, thisIt;
-    // list of Timers which should be deleted from this series
-    std::list<Timer*>* toErase = new std::list<Timer*>();
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>&
+BasicTimerseries<Clock, TimerType, Allocator>::operator -=(
+        const BasicTimerseries& rhs) {
+    std::vector<TimerType*> remaining, toErase;
+    TimerIndex<TimerType> rhsIndex(rhs.mTimer);
 
-    // check for every combination of two Timers in both series
-    for(rhsIt = rhs.mTimer->begin(); rhsIt != rhs.mTimer->end(); ++rhsIt){
-        for(thisIt = this->mTimer->begin();
-                thisIt != this->mTimer->end(); ++thisIt){
+    remaining.reserve(this->mTimer.size());
 
-            // reference Timer for simplicity
-            // iterator -*-> Timer* -*-> Timer
-            Timer& rhsTimer = **rhsIt;
-            Timer& thisTimer = **thisIt;
-
-            // if the Timers are equal, mark them to be deleted
-            if(thisTimer.isEqual(rhsTimer)) {
-                toErase->push_back(*thisIt);
-            }
+    for(TimerType* thisTimer: this->mTimer){
+        // if an equal Timer is in rhs, mark this one to be deleted
+        if(rhsIndex.contains(*thisTimer)) {
+            toErase.push_back(thisTimer);
+        } else {
+            remaining.push_back(thisTimer);
         }
     }
 
+    this->mTimer.swap(remaining);
+
     // delete every Timer that has been marked
-    for(Timer* timer: *toErase){
-        //remove Timer from list
-        this->mTimer->remove(timer);
-        //free memory for the Timer
-        delete timer;
+    for(TimerType* timer: toErase){
+        this->deleteTimer(timer);
     }
 
-    // free memory for the list of Timer which were to be deleted
-    delete toErase;
     return *this;
 }
 
@@ -168,12 +323,15 @@ Timerseries& Timerseries::operator -=(const Timerseries& rhs) {
  * This removes a timer and all its copies from this list, by encapsulating it
  * in a new list and use the method to remove a complete list.
  */
-Timerseries& Timerseries::operator -=(const Timer& timerToRemove) {
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>&
+BasicTimerseries<Clock, TimerType, Allocator>::operator -=(
+        const TimerType& timerToRemove) {
     /*new list to encapsulate the timer*/
-    Timerseries timersToRemove;
+    BasicTimerseries timersToRemove;
 
     /*add a copy of the timer to the list*/
-    timersToRemove += new Timer(timerToRemove);
+    timersToRemove += new TimerType(timerToRemove);
 
     /*remove the timer from this objects list of timers*/
     *this -= timersToRemove;
@@ -184,79 +342,149 @@ Timerseries& Timerseries::operator -=(const Timer& timerToRemove) {
 /*
  * Add all Timers of both series to a new series and return this.
  */
-const Timerseries Timerseries::operator +(const Timerseries& rhs) {
-    Timerseries newTimerseries(*this);
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>::operator +(
+        const BasicTimerseries& rhs) const & {
+    BasicTimerseries newTimerseries(*this);
 
     newTimerseries += rhs;
 
     return newTimerseries;
 }
 
+/*
+ * This series is a temporary, so rhs is added to it instead of a copy.
+ */
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>::operator +(
+        const BasicTimerseries& rhs) && {
+    *this += rhs;
+
+    return std::move(*this);
+}
+
 /*
  * Add the given timer to this series. This series handles the timer from then
  * on. If the series is destroyed, it will destroy this timer as well.
  */
-const Timerseries Timerseries::operator +(Timer* timerToAdd) {
-    Timerseries newTimerseries(*this);
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>::operator +(
+        TimerType* timerToAdd) const & {
+    BasicTimerseries newTimerseries(*this);
 
     newTimerseries += timerToAdd;
 
     return newTimerseries;
 }
 
+/*
+ * This series is a temporary, so the timer is added to it instead of a copy.
+ */
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>::operator +(
+        TimerType* timerToAdd) && {
+    *this += timerToAdd;
+
+    return std::move(*this);
+}
+
 /*
  * Creates a new series, which holds only the elements which are in this series
  * and not in rhs.
  */
-const Timerseries Timerseries::operator -(const Timerseries& rhs) {
-    Timerseries newTimerseries(*this);
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>::operator -(
+        const BasicTimerseries& rhs) const & {
+    BasicTimerseries newTimerseries(*this);
 
     newTimerseries -= rhs;
 
     return newTimerseries;
 }
 
+/*
+ * This series is a temporary, so rhs is subtracted from it instead of a
+ * copy.
+ */
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>::operator -(
+        const BasicTimerseries& rhs) && {
+    *this -= rhs;
+
+    return std::move(*this);
+}
+
 /*
  * Removes the given Timer and all its copies from the list.
  */
-const Timerseries Timerseries::operator -(const Timer& timerToRemove) {
-    Timerseries newTimerseries(*this);
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>::operator -(
+        const TimerType& timerToRemove) const & {
+    BasicTimerseries newTimerseries(*this);
 
     newTimerseries -= timerToRemove;
 
     return newTimerseries;
 }
 
+/*
+ * This series is a temporary, so the timer is removed from it instead of a
+ * copy.
+ */
+template<class Clock, class TimerType, class Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>
+BasicTimerseries<Clock, TimerType, Allocator>::operator -(
+        const TimerType& timerToRemove) && {
+    *this -= timerToRemove;
+
+    return std::move(*this);
+}
+
 /*
  * Checks whether the series are the same object or if they have the same size,
  * whether all elements are the same. Therefore if the have the same size and
- * the difference contains no elements, the both series are the same.
+ * every element has an equal one in rhs, the both series are the same. This is
+ * the same as an empty difference, but needs no copy of this series.
  */
-bool Timerseries::operator ==(const Timerseries& rhs)  const{
+template<class Clock, class TimerType, class Allocator>
+bool BasicTimerseries<Clock, TimerType, Allocator>::operator ==(
+        const BasicTimerseries& rhs)  const{
     // if the objects are the same, this shoul be true
     if(this == &rhs) {
         return true;
     }
 
     // if the size differs, they could not be equal
-    if(this->getSize() == rhs.getSize()){
-        Timerseries newTimerseries(*this);
-        newTimerseries -= rhs;
+    if(this->getSize() != rhs.getSize()){
+        return false;
+    }
 
-        // if the are of the same size and a subtraction leaves no elements,
-        // all elements are equally present in both series
-        if(newTimerseries.getSize() == 0) {
-            return true;
+    TimerIndex<TimerType> rhsIndex(rhs.mTimer);
+
+    // if the are of the same size and a subtraction would leave no elements,
+    // all elements are equally present in both series
+    for(const TimerType* thisTimer: this->mTimer){
+        if(!rhsIndex.contains(*thisTimer)) {
+            return false;
         }
     }
 
-    return false;
+    return true;
 }
 
 /*
  * Uses the check for equality to answer the question for inequaliy.
  */
-bool Timerseries::operator !=(const Timerseries& rhs) const {
+template<class Clock, class TimerType, class Allocator>
+bool BasicTimerseries<Clock, TimerType, Allocator>::operator !=(
+        const BasicTimerseries& rhs) const {
     return !(*this == rhs);
 }
 
@@ -264,7 +492,9 @@ bool Timerseries::operator !=(const Timerseries& rhs) const {
  * This series is a true super-set if all elements of rhs are in this series,
  * but there is at least one element more in this series than in rhs.
  */
-bool Timerseries::operator >(const Timerseries& rhs)  const{
+template<class Clock, class TimerType, class Allocator>
+bool BasicTimerseries<Clock, TimerType, Allocator>::operator >(
+        const BasicTimerseries& rhs)  const{
     // if the objects are the same, this could not be a true super-set of rhs
     if(this == &rhs){  // the objects are the same
         return false;
@@ -286,7 +516,9 @@ bool Timerseries::operator >(const Timerseries& rhs)  const{
  * Check if rhs is a true super-set of this series to know if this series is a
  * true sub-set ob rhs.
  */
-bool Timerseries::operator <(const Timerseries& rhs)  const{
+template<class Clock, class TimerType, class Allocator>
+bool BasicTimerseries<Clock, TimerType, Allocator>::operator <(
+        const BasicTimerseries& rhs)  const{
     return rhs > *this;
 }
 
@@ -294,10 +526,12 @@ bool Timerseries::operator <(const Timerseries& rhs)  const{
  * Checks if this series is a super-set of rhs. It first checks for the address
  * and the size of the series, to prevent unnecessary checks of all elements.
  * This series is a super-set, if this series is bigger or of equal size as rhs
- * and if the number of equal elements is equal to rhs. Therefore at lease each
- * element of rhs is in this series.
+ * and if the number of equal pairs of elements is equal to rhs. Therefore at
+ * lease each element of rhs is in this series.
  */
-bool Timerseries::operator >=(const Timerseries& rhs)  const{
+template<class Clock, class TimerType, class Allocator>
+bool BasicTimerseries<Clock, TimerType, Allocator>::operator >=(
+        const BasicTimerseries& rhs)  const{
     // if both series are the same, this series is a super-set of rhs
     if(this == &rhs) {  // both objects are the same
         return true;
@@ -308,38 +542,32 @@ bool Timerseries::operator >=(const Timerseries& rhs)  const{
         return false;
     }
 
-    std::list<Timer*>::iterator rhsIt, thisIt;
-    int countEquals = 0;
+    TimerIndex<TimerType> thisIndex(this->mTimer);
+    std::size_t rhsSize = rhs.mTimer.size();
+    std::size_t countEquals = 0;
 
-    // check every possible combination of elements of both lists
-    for(rhsIt = rhs.mTimer->begin(); rhsIt != rhs.mTimer->end(); ++rhsIt){
-        for(thisIt = this->mTimer->begin();
-                thisIt != this->mTimer->end(); ++thisIt){
+    // count the equal pairs of elements of both series, only Timer with the
+    // same readings can be equal
+    for(const TimerType* rhsTimer: rhs.mTimer){
+        countEquals += thisIndex.countEqual(*rhsTimer,
+            rhsSize - countEquals + 1);
 
-            // reference Timer for simplicity
-            // iterator -*-> Timer* -*-> Timer
-            Timer& rhsTimer = **rhsIt;
-            Timer& thisTimer = **thisIt;
-
-            // if the Timer are the same, increment the number of equal elements
-            if(rhsTimer.isEqual(thisTimer)) {
-                countEquals++;
-            }
+        // the count can only grow, so there are too many equal pairs
+        if(countEquals > rhsSize) {
+            return false;
         }
     }
 
     // check if all elements of rhs are in this series
-    if(countEquals == rhs.getSize()){
-        return true;
-    } else {
-        return false;
-    }
+    return countEquals == rhsSize;
 }
 /*
  * Check if rhs is a super-set of this series to know if this series is a
  * sub-set ob rhs.
  */
-bool Timerseries::operator <=(const Timerseries& rhs)  const{
+template<class Clock, class TimerType, class Allocator>
+bool BasicTimerseries<Clock, TimerType, Allocator>::operator <=(
+        const BasicTimerseries& rhs)  const{
     return rhs >= *this;
 }
 
@@ -347,28 +575,36 @@ bool Timerseries::operator <=(const Timerseries& rhs)  const{
  * Add a new and existing Timer to this series. This method is now deprecated.
  * You can use operator+= and operator+ instead;
  */
-void Timerseries::addTimer(Timer* newTimer) {
-    this->mTimer->push_back(newTimer);
+template<class Clock, class TimerType, class Allocator>
+void BasicTimerseries<Clock, TimerType, Allocator>::addTimer(
+        TimerType* newTimer) {
+    this->mTimer.push_back(newTimer);
+    ++(this->mAdoptedCount);
 }
 
 /*
- * Returns a pointer to the internal container. This SHOULD NOT be used from
+ * Returns a reference to the internal container. This SHOULD NOT be used from
  * outside of this class.
  */
-const std::list<Timer*>& Timerseries::getTimer() const{
-    return *(this->mTimer);
+template<class Clock, class TimerType, class Allocator>
+const std::vector<TimerType*>&
+BasicTimerseries<Clock, TimerType, Allocator>::getTimer() const{
+    return this->mTimer;
 }
 
 /*
  * Returns a copied list of all Timer in this series. This could take a lot of
  * memory and time since all the elements are copied sequentially.
  */
-std::list<Timer*>* Timerseries::getAllTimer() const{
-    std::list<Timer*>* allTimer = new std::list<Timer*>();
+template<class Clock, class TimerType, class Allocator>
+std::list<TimerType*>*
+BasicTimerseries<Clock, TimerType, Allocator>::getAllTimer() const{
+    std::list<TimerType*>* allTimer =
+        new std::list<TimerType*>();
 
     // for every Timer in this series, push a copy to the new list
-    for (const Timer* timer : *(this->mTimer)) {
-        allTimer->push_back(new Timer(*timer));
+    for (const TimerType* timer : this->mTimer) {
+        allTimer->push_back(new TimerType(*timer));
     }
 
     return allTimer;
@@ -376,44 +612,68 @@ std::list<Timer*>* Timerseries::getAllTimer() const{
 
 /*
  * Runs through all Timer and stops the ones, running at the moment. If a Timer
- * is not running, nothig happend to it.
+ * is not running, nothig happend to it. The clock is read only once.
  */
-void Timerseries::stopAllTimer() const {
-    for(Timer* timer: *(this->mTimer)){
-        timer->stop();
+template<class Clock, class TimerType, class Allocator>
+void BasicTimerseries<Clock, TimerType, Allocator>::stopAllTimer() const {
+    std::int64_t reading = Clock::read();
+
+    for(TimerType* timer: this->mTimer){
+        stopTimerAt(*timer, reading);
     }
 }
 
 /*
- * This destroys all elements and creates a new container for a new series of
- * Timer. Beware, since this can render pointer invalid.
+ * This destroys all elements and keeps the memory of the container and of the
+ * allocator for a new series of Timer. Beware, since this can render pointer
+ * invalid.
  */
-void Timerseries::clear() {
-    for(Timer* timer: *(this->mTimer)){
-        delete timer;
-        timer = nullptr;
-    }
+template<class Clock, class TimerType, class Allocator>
+void BasicTimerseries<Clock, TimerType, Allocator>::clear() {
+    this->deleteAllTimer();
+}
 
-    delete this->mTimer;
+/*
+ * This method traverses the container and removes the given Timer from it. If
+ * this Timer is not in the series, nothing happens. A Timer added by pointer
+ * is handed back to the caller. A Timer of the allocator stays with it.
+ */
+template<class Clock, class TimerType, class Allocator>
+void BasicTimerseries<Clock, TimerType, Allocator>::removeTimer(
+        TimerType* const toDelete) {
+    typename std::vector<TimerType*>::iterator newEnd =
+        std::remove(this->mTimer.begin(), this->mTimer.end(), toDelete);
+    std::size_t removed = this->mTimer.end() - newEnd;
+
+    if(removed > 0 and !this->mAllocator.owns(toDelete)) {
+        this->mAdoptedCount -= removed;
+    }
 
-    this->mTimer = new std::list<Timer*>();
+    this->mTimer.erase(newEnd, this->mTimer.end());
 }
 
 /*
- * This method traverses the container and removes the given Timer from it. If
- * this Timer is not in the series, nothing happens.
+ * This adds a new blank Timer of the allocator to the series. If appending
+ * fails, the Timer is left to the allocator.
  */
-void Timerseries::removeTimer(Timer* const toDelete) {
-    this->mTimer->remove(toDelete);
+template<class Clock, class TimerType, class Allocator>
+TimerType* BasicTimerseries<Clock, TimerType, Allocator>::newTimer() {
+    TimerType* newTimer = this->mAllocator.create();
+
+    this->mTimer.push_back(newTimer);
+
+    return newTimer;
 }
 
 /*
- * This adds a new blank Timer to the series.
+ * This adds a copy of the Timer, created by the allocator, to the series.
  */
-Timer* Timerseries::newTimer() {
-    Timer* newTimer = new Timer();
+template<class Clock, class TimerType, class Allocator>
+TimerType* BasicTimerseries<Clock, TimerType, Allocator>::newTimer(
+        const TimerType& orig) {
+    TimerType* newTimer = this->mAllocator.create(orig);
 
-    this->mTimer->push_back(newTimer);
+    this->mTimer.push_back(newTimer);
 
     return newTimer;
 }
@@ -423,8 +683,9 @@ Timer* Timerseries::newTimer() {
  * that the time measured does not contain the time needed to add the Timer to
  * the series.
  */
-Timer* Timerseries::newStartedTimer() {
-    Timer* newTimer = this->newTimer();
+template<class Clock, class TimerType, class Allocator>
+TimerType* BasicTimerseries<Clock, TimerType, Allocator>::newStartedTimer() {
+    TimerType* newTimer = this->newTimer();
 
     newTimer->start();
 
@@ -435,10 +696,12 @@ Timer* Timerseries::newStartedTimer() {
  * This returns a Timestamp for every timer in the series. The timestamp holds
  * the duration the timer ran.
  */
-std::list<Timestamp>* Timerseries::getTimes() const {
+template<class Clock, class TimerType, class Allocator>
+std::list<Timestamp>* BasicTimerseries<Clock, TimerType, Allocator>::getTimes(
+        ) const {
     std::list<Timestamp>* times = new std::list<Timestamp>();
 
-    for(const Timer* timer: *(this->mTimer)){
+    for(const TimerType* timer: this->mTimer){
         times->push_back(timer->getTime());
     }
 
@@ -450,10 +713,12 @@ std::list<Timestamp>* Timerseries::getTimes() const {
  * Due to the limited precission of the variable type, this can be inaccurate
  * in the last digits.
  */
-std::list<double>* Timerseries::getTimesInSeconds() const {
+template<class Clock, class TimerType, class Allocator>
+std::list<double>*
+BasicTimerseries<Clock, TimerType, Allocator>::getTimesInSeconds() const {
     std::list<double>* times = new std::list<double>();
 
-    for(const Timer* timer: *(this->mTimer)){
+    for(const TimerType* timer: this->mTimer){
         times->push_back(timer->getTimeInSeconds());
     }
 
@@ -465,10 +730,12 @@ std::list<double>* Timerseries::getTimesInSeconds() const {
  * milliseconds. Due to the limited precission of the variable type, this can be
  * inaccurate in the last digits.
  */
-std::list<double>* Timerseries::getTimesInMilliSeconds() const {
+template<class Clock, class TimerType, class Allocator>
+std::list<double>*
+BasicTimerseries<Clock, TimerType, Allocator>::getTimesInMilliSeconds() const {
     std::list<double>* times = new std::list<double>();
 
-    for(const Timer* timer: *(this->mTimer)){
+    for(const TimerType* timer: this->mTimer){
         times->push_back(timer->getTimeInMilliSeconds());
     }
 
@@ -480,10 +747,12 @@ std::list<double>* Timerseries::getTimesInMilliSeconds() const {
  * microseconds. Due to the limited precission of the variable type, this can be
  * inaccurate in the last digits.
  */
-std::list<double>* Timerseries::getTimesInMicroSeconds() const {
+template<class Clock, class TimerType, class Allocator>
+std::list<double>*
+BasicTimerseries<Clock, TimerType, Allocator>::getTimesInMicroSeconds() const {
     std::list<double>* times = new std::list<double>();
 
-    for(const Timer* timer: *(this->mTimer)){
+    for(const TimerType* timer: this->mTimer){
         times->push_back(timer->getTimeInMicroSeconds());
     }
 
@@ -495,10 +764,12 @@ std::list<double>* Timerseries::getTimesInMicroSeconds() const {
  * nanoseconds. Due to the limited precission of the variable type, this can be
  * inaccurate in the last digits.
  */
-std::list<double>* Timerseries::getTimesInNanoSeconds() const {
+template<class Clock, class TimerType, class Allocator>
+std::list<double>*
+BasicTimerseries<Clock, TimerType, Allocator>::getTimesInNanoSeconds() const {
     std::list<double>* times = new std::list<double>();
 
-    for(const Timer* timer: *(this->mTimer)){
+    for(const TimerType* timer: this->mTimer){
         times->push_back(timer->getTimeInNanoSeconds());
     }
 
@@ -510,10 +781,12 @@ std::list<double>* Timerseries::getTimesInNanoSeconds() const {
  * timer. Due to the limited precission of the variable type, this can be
  * inaccurate in the last digits.
  */
-std::list<double>* Timerseries::getFrequencies() const {
+template<class Clock, class TimerType, class Allocator>
+std::list<double>*
+BasicTimerseries<Clock, TimerType, Allocator>::getFrequencies() const {
     std::list<double>* frequencies = new std::list<double>();
 
-    for(const Timer* timer: *(this->mTimer)){
+    for(const TimerType* timer: this->mTimer){
         frequencies->push_back(timer->getFrequency());
     }
 
@@ -521,8 +794,211 @@ std::list<double>* Timerseries::getFrequencies() const {
 }
 
 /*
- * Returns the number of Timer in this series.
+ * Copies the durations without allocating.
  */
-int Timerseries::getSize() const {
-    return this->mTimer->size();
+template<class Clock, class TimerType, class Allocator>
+std::size_t BasicTimerseries<Clock, TimerType, Allocator>::getTimes(
+        Timestamp* buffer, std::size_t size) const {
+    return copyView(this->viewTimes(), buffer, size);
 }
+
+/*
+ * Copies the times in seconds without allocating.
+ */
+template<class Clock, class TimerType, class Allocator>
+std::size_t BasicTimerseries<Clock, TimerType, Allocator>::getTimesInSeconds(
+        double* buffer, std::size_t size) const {
+    return copyView(this->viewTimesInSeconds(), buffer, size);
+}
+
+/*
+ * Copies the times in milliseconds without allocating.
+ */
+template<class Clock, class TimerType, class Allocator>
+std::size_t
+BasicTimerseries<Clock, TimerType, Allocator>::getTimesInMilliSeconds(
+        double* buffer, std::size_t size) const {
+    return copyView(this->viewTimesInMilliSeconds(), buffer, size);
+}
+
+/*
+ * Copies the times in microseconds without allocating.
+ */
+template<class Clock, class TimerType, class Allocator>
+std::size_t
+BasicTimerseries<Clock, TimerType, Allocator>::getTimesInMicroSeconds(
+        double* buffer, std::size_t size) const {
+    return copyView(this->viewTimesInMicroSeconds(), buffer, size);
+}
+
+/*
+ * Copies the times in nanoseconds without allocating.
+ */
+template<class Clock, class TimerType, class Allocator>
+std::size_t
+BasicTimerseries<Clock, TimerType, Allocator>::getTimesInNanoSeconds(
+        double* buffer, std::size_t size) const {
+    return copyView(this->viewTimesInNanoSeconds(), buffer, size);
+}
+
+/*
+ * Copies the frequencies without allocating.
+ */
+template<class Clock, class TimerType, class Allocator>
+std::size_t BasicTimerseries<Clock, TimerType, Allocator>::getFrequencies(
+        double* buffer, std::size_t size) const {
+    return copyView(this->viewFrequencies(), buffer, size);
+}
+
+/*
+ * The view iterates over the container of Timer pointers.
+ */
+template<class Clock, class TimerType, class Allocator>
+TimerValueView<TimerType> BasicTimerseries<Clock, TimerType, Allocator>::view(
+        typename TimerValueView<TimerType>::Getter getter) const {
+    return TimerValueView<TimerType>(this->mTimer.data(),
+        this->mTimer.data() + this->mTimer.size(), getter);
+}
+
+/*
+ * Returns a view on the durations.
+ */
+template<class Clock, class TimerType, class Allocator>
+TimerValueView<TimerType, const Timestamp>
+BasicTimerseries<Clock, TimerType, Allocator>::viewTimes() const {
+    return TimerValueView<TimerType, const Timestamp>(this->mTimer.data(),
+        this->mTimer.data() + this->mTimer.size(), &TimerType::getTime);
+}
+
+/*
+ * Returns a view on the times in seconds.
+ */
+template<class Clock, class TimerType, class Allocator>
+TimerValueView<TimerType>
+BasicTimerseries<Clock, TimerType, Allocator>::viewTimesInSeconds() const {
+    return this->view(&TimerType::getTimeInSeconds);
+}
+
+/*
+ * Returns a view on the times in milliseconds.
+ */
+template<class Clock, class TimerType, class Allocator>
+TimerValueView<TimerType>
+BasicTimerseries<Clock, TimerType, Allocator>::viewTimesInMilliSeconds() const {
+    return this->view(&TimerType::getTimeInMilliSeconds);
+}
+
+/*
+ * Returns a view on the times in microseconds.
+ */
+template<class Clock, class TimerType, class Allocator>
+TimerValueView<TimerType>
+BasicTimerseries<Clock, TimerType, Allocator>::viewTimesInMicroSeconds() const {
+    return this->view(&TimerType::getTimeInMicroSeconds);
+}
+
+/*
+ * Returns a view on the times in nanoseconds.
+ */
+template<class Clock, class TimerType, class Allocator>
+TimerValueView<TimerType>
+BasicTimerseries<Clock, TimerType, Allocator>::viewTimesInNanoSeconds() const {
+    return this->view(&TimerType::getTimeInNanoSeconds);
+}
+
+/*
+ * Returns a view on the frequencies.
+ */
+template<class Clock, class TimerType, class Allocator>
+TimerValueView<TimerType>
+BasicTimerseries<Clock, TimerType, Allocator>::viewFrequencies() const {
+    return this->view(&TimerType::getFrequency);
+}
+
+/*
+ * Returns a view on the Timer themselves.
+ */
+template<class Clock, class TimerType, class Allocator>
+TimerView<TimerType>
+BasicTimerseries<Clock, TimerType, Allocator>::viewTimer() const {
+    return TimerView<TimerType>(this->mTimer.data(),
+        this->mTimer.data() + this->mTimer.size());
+}
+
+/*
+ * Gives a Timer back to the allocator, or deletes it if it has been added by
+ * pointer.
+ */
+template<class Clock, class TimerType, class Allocator>
+void BasicTimerseries<Clock, TimerType, Allocator>::deleteTimer(
+        TimerType* timer) {
+    if(this->mAllocator.owns(timer)) {
+        this->mAllocator.destroy(timer);
+    } else {
+        delete timer;
+        --(this->mAdoptedCount);
+    }
+}
+
+/*
+ * Only the Timer added by pointer are deleted one by one. Finding them calls
+ * owns() for every Timer, which takes O(n log n) for an arena. All others are
+ * destroyed by resetting the allocator, which frees no memory, but still
+ * calls the destructor of every Timer, so it takes linear time.
+ */
+template<class Clock, class TimerType, class Allocator>
+void BasicTimerseries<Clock, TimerType, Allocator>::deleteAllTimer() {
+    if(this->mAdoptedCount > 0) {
+        for(TimerType* timer: this->mTimer){
+            if(!this->mAllocator.owns(timer)) {
+                delete timer;
+            }
+        }
+
+        this->mAdoptedCount = 0;
+    }
+
+    this->mAllocator.reset();
+    this->mTimer.clear();
+}
+
+/*
+ * Returns the number of Timer in this series.
+ */
+template<class Clock, class TimerType, class Allocator>
+int BasicTimerseries<Clock, TimerType, Allocator>::getSize() const {
+    return this->mTimer.size();
+}
+
+template class BasicTimerseries<RealtimeClock>;
+template class BasicTimerseries<MonotonicClock>;
+template class BasicTimerseries<MonotonicRawClock>;
+template class BasicTimerseries<BoottimeClock>;
+template class BasicTimerseries<ProcessCpuClock>;
+template class BasicTimerseries<ThreadCpuClock>;
+template class BasicTimerseries<TscClock>;
+
+template class BasicTimerseries<RealtimeClock, BasicCpuTimer<RealtimeClock> >;
+template class BasicTimerseries<MonotonicClock, BasicCpuTimer<MonotonicClock> >;
+template class BasicTimerseries<MonotonicRawClock,
+    BasicCpuTimer<MonotonicRawClock> >;
+template class BasicTimerseries<BoottimeClock, BasicCpuTimer<BoottimeClock> >;
+template class BasicTimerseries<TscClock, BasicCpuTimer<TscClock> >;
+
+template class BasicTimerseries<RealtimeClock, BasicPerfTimer<RealtimeClock> >;
+template class BasicTimerseries<MonotonicClock,
+    BasicPerfTimer<MonotonicClock> >;
+template class BasicTimerseries<MonotonicRawClock,
+    BasicPerfTimer<MonotonicRawClock> >;
+template class BasicTimerseries<BoottimeClock, BasicPerfTimer<BoottimeClock> >;
+template class BasicTimerseries<TscClock, BasicPerfTimer<TscClock> >;
+
+template class BasicTimerseries<RealtimeClock,
+    BasicConcurrentTimer<RealtimeClock> >;
+template class BasicTimerseries<MonotonicClock,
+    BasicConcurrentTimer<MonotonicClock> >;
+template class BasicTimerseries<MonotonicRawClock,
+    BasicConcurrentTimer<MonotonicRawClock> >;
+template class BasicTimerseries<BoottimeClock,
+    BasicConcurrentTimer<BoottimeClock> >;
+template class BasicTimerseries<TscClock, BasicConcurrentTimer<TscClock> >;
@@ -37,9 +37,13 @@
 #ifndef TIMERSERIES_H
 #define	TIMERSERIES_H
 
+#include <cstddef>
 #include <list>
+#include <vector>
 #include "Timer.h"
 #include "Timestamp.h"
+#include "TimerArena.h"
+#include "TimeView.h"
 
 /**
  * \brief This class stores series of Timer.
@@ -47,9 +51,23 @@
  * This class facilitates the use of large numbers of timers. Especially those
  * created in loop and added automatically to a Timerseries.
  *
+ * All Timer of a series use the same clock. Timerseries is the instantiation on
+ * MonotonicClock.
+ *
+ * The Timer created by the series are allocated by its allocator, a
+ * TimerArena by default, so creating a Timer does not call the global
+ * allocator and clear() destroys them without freeing memory. A Timer added by
+ * pointer is deleted by the series.
+ *
  * \attention This class is \b NOT reentrant and \b NOT thread-safe.
+ * \tparam Clock One of the clock policies defined in Clock.h.
+ * \tparam TimerType The type of the Timer in the series, BasicTimer by default
+ * or e.g. BasicCpuTimer. All of them measure with the given clock.
+ * \tparam Allocator The allocator of the Timer, see TimerArena.
  */
-class Timerseries {
+template<class Clock, class TimerType = BasicTimer<Clock>,
+    class Allocator = TimerArena<TimerType> >
+class BasicTimerseries {
 public:
 
     /**
@@ -57,7 +75,7 @@ public:
      *
      * Creates a new Timerseries with an empty container for Timer.
      */
-    Timerseries();
+    BasicTimerseries();
 
     /**
      * \brief Copy constructor.
@@ -70,7 +88,17 @@ public:
      * Timers are copied.
      * @param orig
      */
-    Timerseries(const Timerseries& orig);
+    BasicTimerseries(const BasicTimerseries& orig);
+
+    /**
+     * \brief Move constructor.
+     *
+     * Takes over all Timer of the original Timerseries without copying them.
+     * Pointers to the Timer stay valid. The original series is empty
+     * afterwards.
+     * @param orig
+     */
+    BasicTimerseries(BasicTimerseries&& orig);
 
     /**
      * \brief Standard destructor.
@@ -78,7 +106,7 @@ public:
      * \attention This destroys all Timers contained in the Timerseries. This
      * can render pointer invalid.
      */
-    virtual ~Timerseries();
+    virtual ~BasicTimerseries();
 
     /**
      * \brief Assigns another Timerseries to this one.
@@ -87,7 +115,16 @@ public:
      * Timers are copied.
      * @param rhs
      */
-    Timerseries& operator=(const Timerseries& rhs);
+    BasicTimerseries& operator=(const BasicTimerseries& rhs);
+
+    /**
+     * \brief Moves the Timer of another Timerseries into this one.
+     *
+     * The Timer of this series are destroyed, the ones of rhs are taken over
+     * without copying them. rhs is empty afterwards.
+     * @param rhs
+     */
+    BasicTimerseries& operator=(BasicTimerseries&& rhs);
 
     /**
      * \brief Assigns all the timers from the rhs Timerseries to this one.
@@ -96,7 +133,7 @@ public:
      * Timerseries stay independent
      * @param rhs
      */
-    Timerseries& operator+=(const Timerseries& rhs);
+    BasicTimerseries& operator+=(const BasicTimerseries& rhs);
 
     /**
      * \brief Adds the given Timer to this series.
@@ -106,32 +143,43 @@ public:
      *
      * @param timerToAdd
      */
-    Timerseries& operator+=(Timer* timerToAdd);
+    BasicTimerseries& operator+=(TimerType* timerToAdd);
 
     /**
      * \brief This removes all the Timer from this series that are also in the
      * other Timerseries.
      *
-     * \attention At the moment, this is taking O(n^2) time. This could take
-     * very long. As this is the basis for the most comparisons, they will also
-     * take very long.
+     * The removed Timer are destroyed. The allocator reuses their memory for
+     * the next Timer.
+     *
+     * The Timer of rhs are sorted by their readings, so this takes
+     * O((n + m) log m) time for n Timer in this series and m Timer in rhs.
      * @param rhs
      */
-    Timerseries& operator-=(const Timerseries& rhs);
+    BasicTimerseries& operator-=(const BasicTimerseries& rhs);
 
     /**
      * \brief Remove the given Timer from this series.
      *
      * @param timerToRemove
      */
-    Timerseries& operator-=(const Timer& timerToRemove);
+    BasicTimerseries& operator-=(const TimerType& timerToRemove);
 
     /**
      * \brief Adds both series together an returns the sum of both.
      *
      * @param rhs
      */
-    const Timerseries operator+(const Timerseries& rhs);
+    BasicTimerseries operator+(const BasicTimerseries& rhs) const &;
+
+    /**
+     * \brief Adds rhs to this temporary series and returns it.
+     *
+     * The Timer of this series are not copied, so a chain like a + b + c only
+     * copies the Timer of a once.
+     * @param rhs
+     */
+    BasicTimerseries operator+(const BasicTimerseries& rhs) &&;
 
     /**
      * \brief This adds a single timer to the a copy of this series and returns
@@ -142,82 +190,97 @@ public:
      *
      * @param timerToAdd
      */
-    const Timerseries operator+(Timer* timerToAdd);
+    BasicTimerseries operator+(TimerType* timerToAdd) const &;
+
+    /**
+     * \brief This adds a single timer to this temporary series and returns it.
+     *
+     * Neither the Timer nor the series are copied.
+     * @param timerToAdd
+     */
+    BasicTimerseries operator+(TimerType* timerToAdd) &&;
 
     /**
      * \brief Subtracts the rhs series from this series and returns the
      * remaining Timer as a new series.
      *
-     * \attention As described for Timerseries::operator-=(), this could take
-     * very long( O(n^2) ).
+     * This takes O(n log n) time, see Timerseries::operator-=().
      * @param rhs
      */
-    const Timerseries operator-(const Timerseries& rhs);
+    BasicTimerseries operator-(const BasicTimerseries& rhs) const &;
+
+    /**
+     * \brief Subtracts the rhs series from this temporary series and returns
+     * it without a copy.
+     * @param rhs
+     */
+    BasicTimerseries operator-(const BasicTimerseries& rhs) &&;
 
     /**
      * \brief This subtracts the timer from the timeseries and returns the
      * remaining Timer a new series.
      * @param timerToRemove
      */
-    const Timerseries operator-(const Timer& timerToRemove);
+    BasicTimerseries operator-(const TimerType& timerToRemove) const &;
+
+    /**
+     * \brief This subtracts the timer from this temporary series and returns
+     * it without a copy.
+     * @param timerToRemove
+     */
+    BasicTimerseries operator-(const TimerType& timerToRemove) &&;
 
     /**
      * \brief Checks if both series consist of equal Timer.
      *
-     * \attention As described for Timerseries::operator-=(), this could take
-     * very long( O(n^2) ).
+     * This takes O(n log n) time, see Timerseries::operator-=().
      * @param rhs
      */
-    bool operator==(const Timerseries& rhs) const;
+    bool operator==(const BasicTimerseries& rhs) const;
 
     /**
      * \brief Checks if both series have a different set of Timer.
      *
-     * \attention As described for Timerseries::operator-=(), this could take
-     * very long( O(n^2) ).
+     * This takes O(n log n) time, see Timerseries::operator-=().
      * @param rhs
      */
-    bool operator!=(const Timerseries& rhs) const;
+    bool operator!=(const BasicTimerseries& rhs) const;
 
     /**
      * \brief Checks if rhs is a subset of this series.
      *
-     * \attention As described for Timerseries::operator-=(), this could take
-     * very long( O(n^2) ).
+     * This takes O(n log n) time, see Timerseries::operator-=().
      * @param rhs
      */
-    bool operator>=(const Timerseries& rhs) const;
+    bool operator>=(const BasicTimerseries& rhs) const;
 
     /**
      * \brief Checks if this series is a subset of rhs.
      *
-     * \attention As described for Timerseries::operator-=(), this could take
-     * very long( O(n^2) ).
+     * This takes O(n log n) time, see Timerseries::operator-=().
      * @param rhs
      */
-    bool operator<=(const Timerseries& rhs) const;
+    bool operator<=(const BasicTimerseries& rhs) const;
 
     /**
      * \brief Checks whether rhs is a true subset of this series.
      *
      * This means (this >= rhs) && (this != rhs)
      *
-     * \attention As described for Timerseries::operator-=(), this could take
-     * very long( O(n^2) ).
+     * This takes O(n log n) time, see Timerseries::operator-=().
      * @param rhs
      */
-    bool operator>(const Timerseries& rhs) const;
+    bool operator>(const BasicTimerseries& rhs) const;
 
     /**
      * \brief Checks whether this series is a true subset of rhs.
      *
      * This means (this <= rhs) && (this != rhs)
      *
-     * \attention As described for Timerseries::operator-=(), this could take
-     * very long( O(n^2) ).
+     * This takes O(n log n) time, see Timerseries::operator-=().
      * @param rhs
      */
-    bool operator<(const Timerseries& rhs) const;
+    bool operator<(const BasicTimerseries& rhs) const;
 
     /**
      * \brief Append the Timer to the Timerseries.
@@ -231,7 +294,7 @@ public:
 #ifndef NO_CXX14
     [[deprecated("Replaced by operator+ and operator+=")]]
 #endif
-    void addTimer(Timer* newTimer);
+    void addTimer(TimerType* newTimer);
 
     /**
      * \brief Create a new Timer in the Timerseries.
@@ -239,7 +302,16 @@ public:
      * This creates a new Timer object, appends it to the Timerseries and
      * returns a pointer to it.
      */
-    Timer* newTimer();
+    TimerType* newTimer();
+
+    /**
+     * \brief Create a copy of the given Timer in the Timerseries.
+     *
+     * Unlike operator+=(TimerType*), the copy is created by the allocator of
+     * the series.
+     * @param orig
+     */
+    TimerType* newTimer(const TimerType& orig);
 
     /**
      * \brief Creates a new Timer and starts it.
@@ -249,7 +321,7 @@ public:
      * append the timer to the container. A pointer to this object is returned,
      * after it has been started.
      */
-    Timer* newStartedTimer();
+    TimerType* newStartedTimer();
 
     /**
      * \brief Stops all the timers in the Timerseries.
@@ -257,6 +329,10 @@ public:
      * This stops sequentially all the timers contained in the series. The
      * behaviour of stopping a Timer is described in Timer::stop(). This method
      * ensures that all timers are ended.
+     *
+     * Timer are stopped with a single reading of the clock, see
+     * Timer::stopAt(), so they all end at the same time. Other timer types
+     * read their clocks each.
      */
     void stopAllTimer() const;
 
@@ -264,9 +340,16 @@ public:
      * \brief Removes the given Timer from the Timeseries.
      *
      * This removes the given Timer from the Timerseries without deleting it.
+     * A Timer added by pointer is handed back to the caller.
+     *
+     * \attention A Timer created by newTimer() belongs to the allocator. It
+     * stays valid until the series is cleared or destroyed, and must not be
+     * deleted. So its memory is only reused after clear(). A long-lived series
+     * should remove such Timer with operator-=(), which gives them back to the
+     * allocator.
      * @param toDelete
      */
-    void removeTimer(Timer* const toDelete);
+    void removeTimer(TimerType* const toDelete);
 
     /**
      * \brief Removes all Timers from the Timerseries.
@@ -292,7 +375,7 @@ public:
      *
      * \attention This method duplicates the Timers contained.
      */
-    std::list<Timer*>* getAllTimer() const;
+    std::list<TimerType*>* getAllTimer() const;
 
     /**
      * \brief Get the Timestamps with the duration of all Timers.
@@ -324,10 +407,134 @@ public:
      */
     std::list<double>* getFrequencies() const;
 
+    /**
+     * \brief Copies the durations of the first Timers into the buffer.
+     *
+     * Copies at most size durations and returns the number copied. This does
+     * not allocate.
+     * @param buffer
+     * @param size The number of elements fitting into the buffer
+     */
+    std::size_t getTimes(Timestamp* buffer, std::size_t size) const;
+
+    /**
+     * \brief Copies the times of the first Timers in seconds into the buffer.
+     *
+     * See getTimes(Timestamp*, std::size_t).
+     * @param buffer
+     * @param size
+     */
+    std::size_t getTimesInSeconds(double* buffer, std::size_t size) const;
+
+    /**
+     * \brief Copies the times of the first Timers in milliseconds into the
+     * buffer.
+     *
+     * See getTimes(Timestamp*, std::size_t).
+     * @param buffer
+     * @param size
+     */
+    std::size_t getTimesInMilliSeconds(double* buffer, std::size_t size) const;
+
+    /**
+     * \brief Copies the times of the first Timers in microseconds into the
+     * buffer.
+     *
+     * See getTimes(Timestamp*, std::size_t).
+     * @param buffer
+     * @param size
+     */
+    std::size_t getTimesInMicroSeconds(double* buffer, std::size_t size) const;
+
+    /**
+     * \brief Copies the times of the first Timers in nanoseconds into the
+     * buffer.
+     *
+     * See getTimes(Timestamp*, std::size_t).
+     * @param buffer
+     * @param size
+     */
+    std::size_t getTimesInNanoSeconds(double* buffer, std::size_t size) const;
+
+    /**
+     * \brief Copies the frequencies of the first Timers into the buffer.
+     *
+     * See getTimes(Timestamp*, std::size_t).
+     * @param buffer
+     * @param size
+     */
+    std::size_t getFrequencies(double* buffer, std::size_t size) const;
+
+    /**
+     * \brief Returns a lazy view on the value the getter returns for each
+     * Timer.
+     *
+     * E.g. view(&CpuTimer::getCpuUtilisation). The values are read while
+     * iterating, nothing is allocated.
+     * @param getter
+     */
+    TimerValueView<TimerType> view(
+        typename TimerValueView<TimerType>::Getter getter) const;
+
+    /**
+     * \brief Returns a lazy view on the durations of all Timers.
+     */
+    TimerValueView<TimerType, const Timestamp> viewTimes() const;
+
+    /**
+     * \brief Returns a lazy view on the times of all Timers in seconds.
+     *
+     * The view can be passed to Statistic without a copy of the times:
+     * \code
+     * TimerValueView<Timer> times = series.viewTimesInSeconds();
+     * Statistic statistic(times.begin(), times.end());
+     * \endcode
+     */
+    TimerValueView<TimerType> viewTimesInSeconds() const;
+
+    /**
+     * \brief Returns a lazy view on the times of all Timers in milliseconds.
+     */
+    TimerValueView<TimerType> viewTimesInMilliSeconds() const;
+
+    /**
+     * \brief Returns a lazy view on the times of all Timers in microseconds.
+     */
+    TimerValueView<TimerType> viewTimesInMicroSeconds() const;
+
+    /**
+     * \brief Returns a lazy view on the times of all Timers in nanoseconds.
+     */
+    TimerValueView<TimerType> viewTimesInNanoSeconds() const;
+
+    /**
+     * \brief Returns a lazy view on the frequencies of all Timers.
+     */
+    TimerValueView<TimerType> viewFrequencies() const;
+
+    /**
+     * \brief Returns a view on all Timers of this Timerseries.
+     *
+     * Unlike getAllTimer(), the Timers are not copied.
+     */
+    TimerView<TimerType> viewTimer() const;
+
+protected:
+    const std::vector<TimerType*>& getTimer() const;
+
 private:
-    std::list<Timer*>* mTimer;
+    void deleteTimer(TimerType* timer);
+    void deleteAllTimer();
 
-    const std::list<Timer*>& getTimer() const;
+    std::vector<TimerType*> mTimer;
+    Allocator mAllocator;
+    std::size_t mAdoptedCount;
 };
 
+/**
+ * \brief The default Timerseries, holding Timer measuring with the monotonic
+ * clock.
+ */
+typedef BasicTimerseries<MonotonicClock> Timerseries;
+
 #endif	/* TIMERSERIES_H */
@@ -37,7 +37,17 @@
 #define	TIMESTAMP_H
 
 #include <time.h>
-#include <cmath>
+#include <cstdint>
+
+/*
+ * C++11 only allows a single return statement in constexpr functions, which
+ * also have to be const. Modifying methods are constexpr since C++14.
+ */
+#if __cplusplus >= 201402L
+#define HRTPP_CONSTEXPR14 constexpr
+#else
+#define HRTPP_CONSTEXPR14 inline
+#endif /*__cplusplus >= 201402L*/
 
 /**
  * \brief This class stores times.
@@ -45,6 +55,11 @@
  * It is used by the Timer class to store its start and stop times. It can also
  * be used to generate timestamps without the use of the Timer class.
  *
+ * The time is stored as a signed 64 bit number of nanoseconds. All arithmetic
+ * and comparisons work on this integer and are constexpr. A struct timespec or
+ * a double is only used when the time is set from or returned as one of them.
+ * The range is about +/- 292 years.
+ *
  * \attention This class is \b NOT reentrant and \b NOT thread-safe.
  */
 class Timestamp {
@@ -62,125 +77,167 @@ public:
      * Needs the time given by clock_gettime(). See man 3 clock_gettime.
      * @param timestamp
      */
-    Timestamp(const struct timespec timestamp);
+    constexpr Timestamp(const struct timespec timestamp) :
+        mNanoSeconds(timestamp.tv_sec * NANOSECONDS_PER_SECOND
+            + timestamp.tv_nsec) {
+    }
 
     /**
-     * \brief Creates a new Timestamp and adds an offset
+     * \brief Creates a new Timestamp from a time in seconds.
      *
-     * The Timestamp is created with the actual time. The offset is interpreted
-     * as seconds and is added to this time.
+     * The offset is interpreted as seconds and rounded to the nearest
+     * nanosecond.
      * @param offset
      */
-    Timestamp(const double offset);
+    constexpr Timestamp(const double offset) :
+        mNanoSeconds(toNanoSeconds(offset)) {
+    }
 
     /**
-     * \brief Creates a new Timestamp an adds an offset
+     * \brief Creates a new Timestamp from seconds and nanoseconds.
      *
-     * The Timestamp is created with the actual time. The seconds and
-     * nanoseconds are added to this time.
+     * The nanoseconds may exceed one second or be negative. They are added to
+     * the seconds.
      * @param secondsOffset
      * @param nanosecondsOffset
      */
-    Timestamp(const long secondsOffset, const long nanosecondsOffset);
-
-    /**
-     * \brief Creates a new Timestamp from another one.
-     *
-     * This is actually a deep copy, so there are no shared variables.
-     * @param orig
-     */
-    Timestamp(const Timestamp& orig);
+    constexpr Timestamp(const long secondsOffset,
+            const long nanosecondsOffset) :
+        mNanoSeconds(secondsOffset * NANOSECONDS_PER_SECOND
+            + nanosecondsOffset) {
+    }
 
     /**
-     * \brief Standard destructor.
-     */
-    virtual ~Timestamp();
-
-    /**
-     * \brief Assign a Timestamp object to another.
-     *
-     * This is actually a deep copy. All variables and therefore the objects
-     * stay independent.
-     * @param rhs
+     * \brief Creates a new Timestamp from a number of nanoseconds.
+     * @param nanoseconds
      */
-    Timestamp& operator=(const Timestamp& rhs);
+    static constexpr Timestamp fromNanoSeconds(const std::int64_t nanoseconds) {
+        return Timestamp(nanoseconds, NanoSecondsTag());
+    }
 
     /**
      * \attention No overflow checking.
      * @param rhs
      */
-    Timestamp& operator+=(const Timestamp& rhs);
+    HRTPP_CONSTEXPR14 Timestamp& operator+=(const Timestamp& rhs) {
+        this->mNanoSeconds += rhs.mNanoSeconds;
+
+        return *this;
+    }
 
     /**
      * \attention No overflow checking.
      * @param rhs
      */
-    Timestamp& operator-=(const Timestamp& rhs);
+    HRTPP_CONSTEXPR14 Timestamp& operator-=(const Timestamp& rhs) {
+        this->mNanoSeconds -= rhs.mNanoSeconds;
+
+        return *this;
+    }
 
     /**
      * \attention No overflow checking.
      * @param rhs
      */
-    const Timestamp operator+(const Timestamp& rhs) const;
+    constexpr const Timestamp operator+(const Timestamp& rhs) const {
+        return fromNanoSeconds(this->mNanoSeconds + rhs.mNanoSeconds);
+    }
 
     /**
      * \attention No overflow checking.
      * @param rhs
      */
-    const Timestamp operator-(const Timestamp& rhs) const;
+    constexpr const Timestamp operator-(const Timestamp& rhs) const {
+        return fromNanoSeconds(this->mNanoSeconds - rhs.mNanoSeconds);
+    }
 
     /**
      * Checks if the both objects are the same or of the same age, i.e. have the
      * same values for seconds and nanoseconds.
      * @param rhs
      */
-    bool operator==(const Timestamp& rhs) const;
+    constexpr bool operator==(const Timestamp& rhs) const {
+        return this->mNanoSeconds == rhs.mNanoSeconds;
+    }
 
     /**
      * Checks for inequality of both values.
      * @param rhs
      */
-    bool operator!=(const Timestamp& rhs) const;
+    constexpr bool operator!=(const Timestamp& rhs) const {
+        return this->mNanoSeconds != rhs.mNanoSeconds;
+    }
 
     /**
      * Checks whether this object is newer as the other.
      * @param rhs
      */
-    bool operator>(const Timestamp& rhs) const;
+    constexpr bool operator>(const Timestamp& rhs) const {
+        return this->mNanoSeconds > rhs.mNanoSeconds;
+    }
 
     /**
      * Checks whether this object is newer or of the same age as the other.
      * @param rhs
      */
-    bool operator>=(const Timestamp& rhs) const;
+    constexpr bool operator>=(const Timestamp& rhs) const {
+        return this->mNanoSeconds >= rhs.mNanoSeconds;
+    }
 
     /**
      * Checks whether this object is older as the other.
      * @param rhs
      */
-    bool operator<(const Timestamp& rhs) const;
+    constexpr bool operator<(const Timestamp& rhs) const {
+        return this->mNanoSeconds < rhs.mNanoSeconds;
+    }
 
     /**
      * Checks whether this object is older or of the same age as the other.
      * @param rhs
      */
-    bool operator<=(const Timestamp& rhs) const;
+    constexpr bool operator<=(const Timestamp& rhs) const {
+        return this->mNanoSeconds <= rhs.mNanoSeconds;
+    }
 
     /**
      * Returns the structure holding the time. It is defined in the time.h
      * header file.
      */
-    struct timespec getTimestamp() const;
+    HRTPP_CONSTEXPR14 struct timespec getTimestamp() const {
+        struct timespec timestamp = {};
+
+        timestamp.tv_sec = this->getSeconds();
+        timestamp.tv_nsec = this->getNanoSeconds();
+
+        return timestamp;
+    }
 
     /**
      * Returning only the seconds part of the time.
+     *
+     * The seconds are rounded down, so the nanoseconds part is never negative.
      */
-    long getSeconds() const;
+    constexpr long getSeconds() const {
+        return this->mNanoSeconds / NANOSECONDS_PER_SECOND
+            - (this->mNanoSeconds % NANOSECONDS_PER_SECOND < 0 ? 1 : 0);
+    }
 
     /**
      * Returns only the nanoseconds part of the time.
      */
-    long getNanoSeconds() const;
+    constexpr long getNanoSeconds() const {
+        return this->mNanoSeconds % NANOSECONDS_PER_SECOND
+            + (this->mNanoSeconds % NANOSECONDS_PER_SECOND < 0 ?
+                NANOSECONDS_PER_SECOND : 0);
+    }
+
+    /**
+     * Returns the whole time as a number of nanoseconds.
+     */
+    constexpr std::int64_t getTotalNanoSeconds() const {
+        return this->mNanoSeconds;
+    }
 
     /**
      * Returns the time in seconds as a double.
@@ -188,7 +245,9 @@ public:
      * \attention There is a possible loss of accuracy due to the precission of
      * double variables.
      */
-    double getTime() const;
+    constexpr double getTime() const {
+        return this->mNanoSeconds / static_cast<double>(NANOSECONDS_PER_SECOND);
+    }
 
     /**
      * Sets the time to the given values
@@ -197,7 +256,9 @@ public:
      * @param seconds
      * @param nanoseconds
      */
-    void set(const long seconds, const long nanoseconds);
+    HRTPP_CONSTEXPR14 void set(const long seconds, const long nanoseconds) {
+        this->mNanoSeconds = seconds * NANOSECONDS_PER_SECOND + nanoseconds;
+    }
 
     /**
      * Sets the time to the given value. The parameter will be interpreted as
@@ -206,7 +267,9 @@ public:
      * \attention No overflow checking for the seconds.
      * @param seconds
      */
-    void set(const double seconds);
+    HRTPP_CONSTEXPR14 void set(const double seconds) {
+        this->mNanoSeconds = toNanoSeconds(seconds);
+    }
 
     /**
      * Sets the seconds part of the time.
@@ -214,7 +277,10 @@ public:
      * \attention No overflow checking.
      * @param seconds
      */
-    void setSeconds(const long seconds);
+    HRTPP_CONSTEXPR14 void setSeconds(const long seconds) {
+        this->mNanoSeconds = seconds * NANOSECONDS_PER_SECOND
+            + this->getNanoSeconds();
+    }
 
     /**
      * Sets the nanoseconds part of the time. Overflow will be returned as
@@ -223,7 +289,14 @@ public:
      *
      * @param nanoseconds
      */
-    long setNanoSeconds(const long nanoseconds);
+    HRTPP_CONSTEXPR14 long setNanoSeconds(const long nanoseconds) {
+        long overflow = fromNanoSeconds(nanoseconds).getSeconds();
+
+        this->mNanoSeconds = this->getSeconds() * NANOSECONDS_PER_SECOND
+            + (nanoseconds - overflow * NANOSECONDS_PER_SECOND);
+
+        return overflow;
+    }
 
     /**
      * Sets the time to the current time.
@@ -236,10 +309,34 @@ public:
      * This returns 1/s. Therefore its unit is Hertz(Hz). Returns 0, if the
      * Timestamp is 0.
      */
-    double getFrequency() const;
+    constexpr double getFrequency() const {
+        return this->mNanoSeconds != 0 ?
+            NANOSECONDS_PER_SECOND / static_cast<double>(this->mNanoSeconds) :
+            0.0;
+    }
 
 private:
-    struct timespec mTimestamp;
+    static constexpr std::int64_t NANOSECONDS_PER_SECOND = 1000000000;
+
+    /*
+     * Selects the constructor taking the number of nanoseconds.
+     */
+    struct NanoSecondsTag {};
+
+    constexpr Timestamp(const std::int64_t nanoseconds, NanoSecondsTag) :
+        mNanoSeconds(nanoseconds) {
+    }
+
+    /*
+     * Rounds the seconds to the nearest nanosecond, halfway cases away from
+     * zero.
+     */
+    static constexpr std::int64_t toNanoSeconds(const double seconds) {
+        return static_cast<std::int64_t>(seconds * NANOSECONDS_PER_SECOND
+            + (seconds < 0.0 ? -0.5 : 0.5));
+    }
+
+    std::int64_t mNanoSeconds;
 };
 
 #endif	/* TIMESTAMP_H */
@@ -37,8 +37,31 @@
 #define	HRTIMERPP_H
 
 #include <hrtimerpp/Timestamp.h>
+#include <hrtimerpp/Clock.h>
+#include <hrtimerpp/Calibration.h>
 #include <hrtimerpp/Timer.h>
+#include <hrtimerpp/CpuTimer.h>
+#include <hrtimerpp/PerfCounters.h>
+#include <hrtimerpp/PerfTimer.h>
+#include <hrtimerpp/ConcurrentTimer.h>
+#include <hrtimerpp/FastTimer.h>
+#include <hrtimerpp/LapTimer.h>
+#include <hrtimerpp/TimerArena.h>
+#include <hrtimerpp/TimeView.h>
 #include <hrtimerpp/Timerseries.h>
+#include <hrtimerpp/ContiguousTimerseries.h>
+#include <hrtimerpp/RingTimerseries.h>
+#include <hrtimerpp/ShardedTimerseries.h>
+#include <hrtimerpp/CpuTimerseries.h>
+#include <hrtimerpp/PerfTimerseries.h>
+#include <hrtimerpp/ScopedTimer.h>
+#include <hrtimerpp/RunningStatistic.h>
 #include <hrtimerpp/Statistic.h>
+#include <hrtimerpp/Histogram.h>
+#include <hrtimerpp/TDigest.h>
+#include <hrtimerpp/P2Estimator.h>
+#include <hrtimerpp/TimerRegistry.h>
+#include <hrtimerpp/TimerBatch.h>
+#include <hrtimerpp/ReservoirTimerseries.h>
 
 #endif	/* HRTIMERPP_H */
@@ -0,0 +1,92 @@
+/*
+ * File:   Check.h
+ * Author: Nils Döring
+ *
+ * Created on October 24, 2026, 11:20 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+#ifndef CHECK_H
+#define	CHECK_H
+
+#include <cmath>
+#include <cstdio>
+
+/*
+ * Minimal checks for the tests run by CTest. A failed check is reported with
+ * its location, the test continues and its exit code is 1.
+ */
+
+inline int& getFailureCount() {
+    static int failures = 0;
+
+    return failures;
+}
+
+inline void check(bool condition, const char* expression, const char* file,
+        int line) {
+    if(not condition) {
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line,
+            expression);
+        ++getFailureCount();
+    }
+}
+
+inline void checkNear(double actual, double expected, double tolerance,
+        const char* expression, const char* file, int line) {
+    if(not (std::abs(actual - expected) <= tolerance)) {
+        std::fprintf(stderr, "%s:%d: check failed: %s is %g, expected %g "
+            "+- %g\n", file, line, expression, actual, expected, tolerance);
+        ++getFailureCount();
+    }
+}
+
+#define CHECK(condition) check((condition), #condition, __FILE__, __LINE__)
+
+#define CHECK_NEAR(actual, expected, tolerance) \
+    checkNear((actual), (expected), (tolerance), #actual, __FILE__, __LINE__)
+
+/*
+ * Checks that actual is within the given fraction of expected.
+ */
+#define CHECK_RELATIVE(actual, expected, fraction) \
+    checkNear((actual), (expected), std::abs((expected) * (fraction)), \
+        #actual, __FILE__, __LINE__)
+
+inline int getExitCode() {
+    return getFailureCount() == 0 ? 0 : 1;
+}
+
+#endif	/* CHECK_H */
+
@@ -0,0 +1,135 @@
+/*
+ * File:   ClockTest.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 24, 2026, 11:25 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+#include <time.h>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include "Clock.h"
+#include "Timer.h"
+#include "Check.h"
+
+namespace {
+
+std::int64_t readDirectly(clockid_t id) {
+    struct timespec time;
+
+    clock_gettime(id, &time);
+
+    return time.tv_sec * static_cast<std::int64_t>(1000000000) + time.tv_nsec;
+}
+
+/*
+ * A reading of the policy lies between two readings of the intended clock,
+ * and the resolution is the one of clock_getres().
+ */
+template<class Clock>
+void testPosixClock(clockid_t expected) {
+    struct timespec resolution;
+
+    CHECK(Clock::id == expected);
+
+    std::int64_t before = readDirectly(expected);
+    std::int64_t reading = Clock::read();
+    std::int64_t after = readDirectly(expected);
+
+    CHECK(before <= reading);
+    CHECK(reading <= after);
+
+    clock_getres(expected, &resolution);
+    CHECK(Clock::getResolution() == Timestamp(resolution));
+    CHECK(Clock::toTimestamp(1500) == Timestamp::fromNanoSeconds(1500));
+}
+
+/*
+ * A Timer measures with the clock of its policy: a sleeping thread takes
+ * wall-clock time, but hardly any CPU time.
+ */
+void testTimerPolicy() {
+    Timer wallClock;
+    BasicTimer<ThreadCpuClock> cpu;
+
+    wallClock.start();
+    cpu.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    cpu.stop();
+    wallClock.stop();
+
+    CHECK(wallClock.getTimeInMilliSeconds() >= 50);
+    CHECK(cpu.getTimeInMilliSeconds() < 25);
+}
+
+/*
+ * The ticks of the counter are converted to the nanoseconds of
+ * MonotonicClock.
+ */
+void testTscClock() {
+    CHECK(TscClock::getResolution() >= Timestamp::fromNanoSeconds(1));
+
+    std::int64_t startTicks = TscClock::read();
+    std::int64_t startTime = MonotonicClock::read();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    std::int64_t stopTicks = TscClock::read();
+    std::int64_t stopTime = MonotonicClock::read();
+
+    Timestamp converted = TscClock::toTimestamp(stopTicks - startTicks);
+
+    CHECK(stopTicks > startTicks);
+    CHECK_RELATIVE(static_cast<double>(converted.getTotalNanoSeconds()),
+        static_cast<double>(stopTime - startTime), 0.05);
+
+    if(not TscClock::isInvariant()) {
+        CHECK(TscClock::getNanoSecondsPerTick() == 1.0);
+    }
+}
+
+}
+
+int main() {
+    testPosixClock<RealtimeClock>(CLOCK_REALTIME);
+    testPosixClock<MonotonicClock>(CLOCK_MONOTONIC);
+    testPosixClock<MonotonicRawClock>(CLOCK_MONOTONIC_RAW);
+    testPosixClock<BoottimeClock>(CLOCK_BOOTTIME);
+    testPosixClock<ProcessCpuClock>(CLOCK_PROCESS_CPUTIME_ID);
+    testPosixClock<ThreadCpuClock>(CLOCK_THREAD_CPUTIME_ID);
+    testTimerPolicy();
+    testTscClock();
+
+    return getExitCode();
+}
@@ -0,0 +1,193 @@
+/*
+ * File:   ConcurrentTimerTest.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 24, 2026, 11:35 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "ConcurrentTimer.h"
+#include "Check.h"
+
+namespace {
+
+const int THREADS = 8;
+const int ROUNDS = 200;
+const int MEASUREMENTS = 20000;
+
+/*
+ * All threads call start() and then stop() at once. Exactly one of them wins
+ * each transition.
+ */
+void testRacingTransitions() {
+    for(int round = 0; round < ROUNDS; ++round) {
+        ConcurrentTimer timer;
+        std::atomic<int> ready(0);
+        std::atomic<int> started(0);
+        std::atomic<int> stopped(0);
+        std::vector<std::thread> threads;
+
+        for(int i = 0; i < THREADS; ++i) {
+            threads.emplace_back([&]() {
+                ++ready;
+                while(ready.load() < THREADS) {
+                    std::this_thread::yield();
+                }
+                if(timer.start()) {
+                    ++started;
+                }
+                while(timer.isReset()) {
+                    std::this_thread::yield();
+                }
+                if(timer.stop()) {
+                    ++stopped;
+                }
+            });
+        }
+        for(std::thread& thread : threads) {
+            thread.join();
+        }
+
+        CHECK(started.load() == 1);
+        CHECK(stopped.load() == 1);
+        CHECK(timer.isStopped());
+        CHECK(timer.getStopTicks() >= timer.getStartTicks());
+        CHECK(not timer.start());
+        CHECK(not timer.stop());
+    }
+}
+
+/*
+ * One thread resets the timer, another one starts and stops it, while readers
+ * take snapshots. A snapshot never mixes the readings of two measurements, so
+ * its duration is never negative.
+ */
+void testResetRacingReaders() {
+    ConcurrentTimer timer;
+    std::atomic<bool> done(false);
+    std::atomic<bool> isReset(false);
+    std::atomic<int> inconsistent(0);
+    std::vector<std::thread> readers;
+
+    for(int i = 0; i < THREADS - 2; ++i) {
+        readers.emplace_back([&]() {
+            while(not done.load()) {
+                Timer snapshot = timer.toTimer();
+
+                if(snapshot.getStopTicks() < snapshot.getStartTicks()) {
+                    ++inconsistent;
+                }
+                if(timer.getTimeInNanoSeconds() < 0) {
+                    ++inconsistent;
+                }
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    std::thread starter([&]() {
+        for(int i = 0; i < MEASUREMENTS; ++i) {
+            while(not isReset.load()) {
+                std::this_thread::yield();
+            }
+            timer.start();
+            timer.stop();
+            isReset = false;
+        }
+    });
+
+    for(int i = 0; i < MEASUREMENTS; ++i) {
+        while(isReset.load()) {
+            std::this_thread::yield();
+        }
+        timer.reset();
+        isReset = true;
+    }
+    starter.join();
+    done = true;
+    for(std::thread& reader : readers) {
+        reader.join();
+    }
+
+    CHECK(inconsistent.load() == 0);
+    CHECK(timer.isStopped());
+}
+
+/*
+ * A copy is a consistent snapshot and independent of the original.
+ */
+void testCopy() {
+    ConcurrentTimer timer;
+
+    CHECK(timer.start());
+    CHECK(timer.stop());
+
+    ConcurrentTimer copy(timer);
+    CHECK(copy.isEqual(timer));
+
+    timer.reset();
+    CHECK(copy.isStopped());
+    CHECK(timer.isReset());
+
+    copy = timer;
+    CHECK(copy.isReset());
+}
+
+void testReset() {
+    ConcurrentTimer timer;
+
+    CHECK(timer.isReset());
+    CHECK(not timer.stop());
+    CHECK(timer.start());
+    CHECK(timer.isRunning());
+    CHECK(timer.stop());
+    timer.reset();
+    CHECK(timer.isReset());
+    CHECK(timer.getTimeInNanoSeconds() == 0);
+    CHECK(timer.start());
+}
+
+}
+
+int main() {
+    testRacingTransitions();
+    testResetRacingReaders();
+    testCopy();
+    testReset();
+
+    return getExitCode();
+}
@@ -0,0 +1,131 @@
+/*
+ * File:   HistogramTest.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 24, 2026, 1:05 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Histogram.h"
+#include "Statistic.h"
+#include "Check.h"
+
+namespace {
+
+const int THREADS = 4;
+const int VALUES = 200000;
+
+/*
+ * With two significant digits, every percentile is within 1 % of the exact
+ * one of the same rank.
+ */
+void testPercentiles() {
+    std::mt19937_64 generator(5);
+    std::lognormal_distribution<double> distribution(std::log(50000.0), 1.0);
+    std::list<double> values;
+    Histogram histogram;
+
+    for(int i = 0; i < VALUES; ++i) {
+        std::int64_t value = std::llround(distribution(generator));
+
+        values.push_back(static_cast<double>(value));
+        histogram.record(value);
+    }
+
+    Statistic exact(std::move(values));
+
+    CHECK(histogram.getNumberOfElements() == VALUES);
+    CHECK(histogram.getMin() == exact.getMin());
+    CHECK(histogram.getMax() == exact.getMax());
+    CHECK_RELATIVE(histogram.getMean(), exact.getMean(), 0.01);
+
+    for(double percentile : {1.0, 10.0, 50.0, 90.0, 99.0, 99.9, 99.99}) {
+        CHECK_RELATIVE(histogram.getPercentile(percentile),
+            exact.getPercentile(percentile, Statistic::NEAREST_RANK), 0.01);
+    }
+}
+
+/*
+ * Threads record into the same histogram without a lock, and the sum of
+ * histograms of each thread equals it.
+ */
+void testConcurrentRecording() {
+    Histogram shared;
+    std::vector<Histogram> own(THREADS);
+    std::vector<std::thread> threads;
+
+    for(int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&shared, &own, t]() {
+            for(int i = 1; i <= VALUES; ++i) {
+                shared.record(i * (t + 1));
+                own[t].record(i * (t + 1));
+            }
+        });
+    }
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+
+    Histogram merged;
+
+    for(const Histogram& histogram : own) {
+        merged += histogram;
+    }
+
+    CHECK(shared.getNumberOfElements() ==
+        static_cast<std::uint64_t>(THREADS * VALUES));
+    CHECK(shared.getMin() == 1);
+    CHECK(shared.getMax() == THREADS * VALUES);
+    CHECK(merged.getNumberOfElements() == shared.getNumberOfElements());
+    for(double percentile : {0.0, 25.0, 50.0, 75.0, 99.0, 100.0}) {
+        CHECK(merged.getPercentile(percentile) ==
+            shared.getPercentile(percentile));
+    }
+}
+
+}
+
+int main() {
+    testPercentiles();
+    testConcurrentRecording();
+
+    return getExitCode();
+}
@@ -0,0 +1,132 @@
+/*
+ * File:   P2EstimatorTest.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 24, 2026, 1:35 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+#include <cmath>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include "P2Estimator.h"
+#include "Statistic.h"
+#include "Check.h"
+
+namespace {
+
+const int VALUES = 200000;
+
+/*
+ * The tracked percentiles of a smooth distribution are within 2 % of the
+ * exact ones.
+ */
+void testTrackedPercentiles() {
+    std::mt19937_64 generator(13);
+    std::lognormal_distribution<double> distribution(std::log(50000.0), 0.5);
+    std::list<double> values;
+    P2Estimator estimator({50, 90, 99});
+
+    for(int i = 0; i < VALUES; ++i) {
+        double value = distribution(generator);
+
+        values.push_back(value);
+        estimator.add(value);
+    }
+
+    Statistic exact(std::move(values));
+
+    CHECK(estimator.getPercentileCount() == 3);
+    CHECK(estimator.getTrackedPercentile(2) == 99);
+    CHECK(estimator.getNumberOfElements() == VALUES);
+    CHECK(estimator.getMin() == exact.getMin());
+    CHECK(estimator.getMax() == exact.getMax());
+    CHECK_RELATIVE(estimator.getMean(), exact.getMean(), 1e-9);
+    CHECK_RELATIVE(estimator.getMedian(), exact.getMedian(), 0.02);
+    CHECK_RELATIVE(estimator.getPercentile(90), exact.getPercentile(90), 0.02);
+    CHECK_RELATIVE(estimator.getPercentile(99), exact.getPercentile(99), 0.02);
+}
+
+/*
+ * With at most five values the percentiles are exact.
+ */
+void testFewValues() {
+    P2Estimator estimator;
+
+    for(double value : {3.0, 1.0, 2.0}) {
+        estimator.add(value);
+    }
+
+    CHECK(estimator.getMedian() == 2);
+    CHECK(estimator.getMin() == 1);
+    CHECK(estimator.getMax() == 3);
+
+    estimator.clear();
+    CHECK(estimator.getNumberOfElements() == 0);
+}
+
+/*
+ * More than MAX_PERCENTILES percentiles and percentiles outside (0, 100) are
+ * rejected.
+ */
+void testInvalidPercentiles() {
+    bool thrown = false;
+
+    try {
+        P2Estimator estimator({10, 20, 30, 40, 50});
+    } catch(const std::invalid_argument&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+    thrown = false;
+
+    try {
+        P2Estimator estimator({101});
+    } catch(const std::invalid_argument&) {
+        thrown = true;
+    }
+    CHECK(thrown);
+}
+
+}
+
+int main() {
+    testTrackedPercentiles();
+    testFewValues();
+    testInvalidPercentiles();
+
+    return getExitCode();
+}
@@ -0,0 +1,132 @@
+/*
+ * File:   ReservoirTimerseriesTest.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 24, 2026, 12:20 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include "ReservoirTimerseries.h"
+#include "Check.h"
+
+namespace {
+
+const std::size_t CAPACITY = 1000;
+const std::int64_t MEASUREMENTS = 1000000;
+const int BINS = 10;
+
+/*
+ * The measurement i has the duration i, so a uniform sample has about the
+ * same number of durations in each tenth of the range.
+ */
+void testUniformity() {
+    ReservoirTimerseries reservoir(CAPACITY, 42);
+    ContiguousTimerseries sample;
+    int bins[BINS] = {};
+
+    for(std::int64_t i = 0; i < MEASUREMENTS; ++i) {
+        reservoir.append(0, i);
+    }
+
+    CHECK(reservoir.getSize() == CAPACITY);
+    CHECK(reservoir.getTotalCount() ==
+        static_cast<std::uint64_t>(MEASUREMENTS));
+    CHECK(reservoir.getSample(sample) == CAPACITY);
+
+    for(int i = 0; i < sample.getSize(); ++i) {
+        ++bins[sample.getStopTimes()[i] * BINS / MEASUREMENTS];
+    }
+
+    std::unique_ptr<Statistic> statistic(reservoir.getStatistic(
+        ReadingsView<MonotonicClock>::NANOSECONDS));
+    CHECK(statistic->getNumberOfElements() == static_cast<int>(CAPACITY));
+    CHECK(statistic->getPopulationSize() ==
+        static_cast<std::uint64_t>(MEASUREMENTS));
+
+    // 100 expected per bin, the standard deviation is 9.5
+    for(int bin = 0; bin < BINS; ++bin) {
+        CHECK_NEAR(bins[bin], CAPACITY / BINS, 40);
+    }
+}
+
+/*
+ * Until the reservoir is full, every measurement is kept.
+ */
+void testFilling() {
+    ReservoirTimerseries reservoir(CAPACITY, 7);
+    ContiguousTimerseries sample;
+
+    for(std::int64_t i = 0; i < 10; ++i) {
+        reservoir.append(0, i);
+    }
+
+    CHECK(reservoir.getSample(sample) == 10);
+    for(int i = 0; i < sample.getSize(); ++i) {
+        CHECK(sample.getStopTimes()[i] == i);
+    }
+
+    reservoir.clear();
+    CHECK(reservoir.getSize() == 0);
+    CHECK(reservoir.getTotalCount() == 0);
+}
+
+/*
+ * Unfinished timers are neither kept nor counted.
+ */
+void testTimers() {
+    ReservoirTimerseries reservoir(CAPACITY, 9);
+    Timer timer;
+
+    reservoir += timer;
+    timer.start();
+    reservoir += timer;
+    CHECK(reservoir.getTotalCount() == 0);
+
+    timer.stop();
+    reservoir += timer;
+    CHECK(reservoir.getTotalCount() == 1);
+}
+
+}
+
+int main() {
+    testUniformity();
+    testFilling();
+    testTimers();
+
+    return getExitCode();
+}
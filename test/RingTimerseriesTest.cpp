@@ -0,0 +1,150 @@
+/*
+ * File:   RingTimerseriesTest.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 24, 2026, 11:50 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "RingTimerseries.h"
+#include "Check.h"
+
+namespace {
+
+const std::int64_t MEASUREMENTS = 1000000;
+
+/*
+ * Once full, the ring keeps the most recent measurements in order.
+ */
+void testOverwrite() {
+    RingTimerseries ring(8);
+    ContiguousTimerseries series;
+
+    CHECK(ring.getCapacity() == 8);
+    for(std::int64_t i = 0; i < 20; ++i) {
+        ring.append(i, 2 * i);
+    }
+
+    CHECK(ring.getSize() == 8);
+    CHECK(ring.getTotalCount() == 20);
+    CHECK(ring.getOverwrittenCount() == 12);
+    CHECK(ring.snapshot(series) == 8);
+    CHECK(series.getSize() == 8);
+    for(int i = 0; i < series.getSize(); ++i) {
+        CHECK(series.getStartTimes()[i] == 12 + i);
+        CHECK(series.getStopTimes()[i] == 24 + 2 * i);
+    }
+
+    series.clear();
+    CHECK(ring.snapshot(series, 3) == 3);
+    CHECK(series.getStartTimes()[0] == 17);
+}
+
+/*
+ * Readers take snapshots while the writer overwrites the ring. Every
+ * measurement they see is complete, i.e. its start and stop belong together,
+ * and the measurements are in order.
+ */
+void testConcurrentSnapshots() {
+    RingTimerseries ring(64);
+    std::atomic<bool> done(false);
+    std::atomic<int> torn(0);
+    std::atomic<int> unordered(0);
+    std::vector<std::thread> readers;
+
+    for(int i = 0; i < 3; ++i) {
+        readers.emplace_back([&]() {
+            ContiguousTimerseries series;
+
+            while(not done.load()) {
+                series.clear();
+                ring.snapshot(series);
+                const std::int64_t* starts = series.getStartTimes();
+                const std::int64_t* stops = series.getStopTimes();
+
+                for(int j = 0; j < series.getSize(); ++j) {
+                    if(stops[j] != 3 * starts[j] + 1) {
+                        ++torn;
+                    }
+                    if(j > 0 and starts[j] <= starts[j - 1]) {
+                        ++unordered;
+                    }
+                }
+            }
+        });
+    }
+
+    for(std::int64_t i = 0; i < MEASUREMENTS; ++i) {
+        ring.append(i, 3 * i + 1);
+    }
+    done = true;
+    for(std::thread& reader : readers) {
+        reader.join();
+    }
+
+    CHECK(torn.load() == 0);
+    CHECK(unordered.load() == 0);
+    CHECK(ring.getTotalCount() == static_cast<std::uint64_t>(MEASUREMENTS));
+}
+
+/*
+ * Only finished timers are recorded.
+ */
+void testTimers() {
+    RingTimerseries ring(4);
+    Timer timer;
+
+    ring += timer;
+    timer.start();
+    ring += timer;
+    CHECK(ring.getTotalCount() == 0);
+
+    timer.stop();
+    ring += timer;
+    CHECK(ring.getTotalCount() == 1);
+}
+
+}
+
+int main() {
+    testOverwrite();
+    testConcurrentSnapshots();
+    testTimers();
+
+    return getExitCode();
+}
@@ -0,0 +1,107 @@
+/*
+ * File:   RunningStatisticTest.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 24, 2026, 12:35 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+#include <list>
+#include <random>
+#include <utility>
+#include "RunningStatistic.h"
+#include "Statistic.h"
+#include "Check.h"
+
+namespace {
+
+/*
+ * Merging the statistics of parts gives the statistic of all values, which
+ * equals the one of Statistic.
+ */
+void testMerge() {
+    std::mt19937_64 generator(1);
+    std::normal_distribution<double> distribution(1000.0, 50.0);
+    std::list<double> values;
+    RunningStatistic parts[4];
+    RunningStatistic sequential;
+
+    for(int i = 0; i < 10000; ++i) {
+        double value = distribution(generator);
+
+        values.push_back(value);
+        sequential.add(value);
+        parts[i % 4] += value;
+    }
+
+    RunningStatistic merged = parts[0] + parts[1];
+    merged += parts[2] + parts[3];
+    Statistic exact(std::move(values));
+
+    CHECK(merged.getNumberOfElements() == 10000);
+    CHECK(merged.getMin() == sequential.getMin());
+    CHECK(merged.getMax() == sequential.getMax());
+    CHECK_RELATIVE(merged.getMean(), sequential.getMean(), 1e-12);
+    CHECK_RELATIVE(merged.getVariance(), sequential.getVariance(), 1e-9);
+    CHECK_RELATIVE(merged.getMean(), exact.getMean(), 1e-12);
+    CHECK_RELATIVE(merged.getVariance(), exact.getVariance(), 1e-9);
+}
+
+/*
+ * Merging with an empty statistic changes nothing.
+ */
+void testEmpty() {
+    RunningStatistic empty;
+    RunningStatistic values;
+
+    values += 1.0;
+    values += 3.0;
+    values += empty;
+    empty += values;
+
+    CHECK(values.getNumberOfElements() == 2);
+    CHECK(empty.getNumberOfElements() == 2);
+    CHECK(empty.getMean() == 2.0);
+    CHECK(empty.getMin() == 1.0);
+    CHECK(empty.getMax() == 3.0);
+}
+
+}
+
+int main() {
+    testMerge();
+    testEmpty();
+
+    return getExitCode();
+}
@@ -0,0 +1,189 @@
+/*
+ * File:   ShardedTimerseriesTest.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 24, 2026, 12:05 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "ShardedTimerseries.h"
+#include "Check.h"
+
+namespace {
+
+const int THREADS = 8;
+const std::int64_t MEASUREMENTS = 50000;
+
+/*
+ * Every thread records its id as the start and a counter as the stop, so a
+ * merged series shows whether measurements are lost or reordered.
+ */
+int checkSeries(const ContiguousTimerseries& series) {
+    std::vector<std::int64_t> next(THREADS, 0);
+    int errors = 0;
+
+    for(int i = 0; i < series.getSize(); ++i) {
+        std::int64_t thread = series.getStartTimes()[i];
+        std::int64_t counter = series.getStopTimes()[i] - MEASUREMENTS * 2;
+
+        if(thread < 0 or thread >= THREADS or counter != next[thread]++) {
+            ++errors;
+        }
+    }
+
+    return errors;
+}
+
+/*
+ * The threads record concurrently while a reader merges the shards. The
+ * reader sees a prefix of every thread, and the final merge has all
+ * measurements.
+ */
+void testConcurrentMerge() {
+    ShardedTimerseries sharded;
+    std::atomic<bool> done(false);
+    std::atomic<int> errors(0);
+    std::vector<std::thread> threads;
+
+    std::thread reader([&]() {
+        while(not done.load()) {
+            ContiguousTimerseries series;
+
+            sharded.snapshot(series);
+            errors += checkSeries(series);
+        }
+    });
+
+    for(int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&sharded, t]() {
+            for(std::int64_t i = 0; i < MEASUREMENTS; ++i) {
+                sharded.append(t, MEASUREMENTS * 2 + i);
+            }
+        });
+    }
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+    done = true;
+    reader.join();
+
+    ContiguousTimerseries series;
+
+    CHECK(errors.load() == 0);
+    CHECK(sharded.getShardCount() == THREADS);
+    CHECK(sharded.getSize() == THREADS * MEASUREMENTS);
+    CHECK(sharded.snapshot(series) ==
+        static_cast<std::size_t>(THREADS * MEASUREMENTS));
+    CHECK(checkSeries(series) == 0);
+
+    std::list<double>* times = sharded.getTimesInNanoSeconds();
+    CHECK(times->size() == static_cast<std::size_t>(THREADS * MEASUREMENTS));
+    delete times;
+
+    sharded.clear();
+    CHECK(sharded.getSize() == 0);
+}
+
+/*
+ * Only finished timers are recorded, and a snapshot is appended to the
+ * measurements already in the series.
+ */
+void testTimers() {
+    ShardedTimerseries sharded;
+    ContiguousTimerseries series;
+    Timer timer;
+
+    sharded += timer;
+    timer.start();
+    sharded += timer;
+    CHECK(sharded.getSize() == 0);
+
+    timer.stop();
+    sharded += timer;
+    series.append(0, 1);
+    CHECK(sharded.snapshot(series) == 1);
+    CHECK(series.getSize() == 2);
+}
+
+/*
+ * A thread records into many more series than any fixed cache would hold.
+ * Each series keeps one shard for the thread and its own measurements.
+ */
+void testManySeries() {
+    const int seriesCount = 300;
+    std::vector<std::unique_ptr<ShardedTimerseries>> series;
+
+    for(int i = 0; i < seriesCount; ++i) {
+        series.emplace_back(new ShardedTimerseries());
+    }
+
+    for(int round = 0; round < 10; ++round) {
+        for(int i = 0; i < seriesCount; ++i) {
+            series[i]->append(i, i + round);
+        }
+    }
+
+    for(int i = 0; i < seriesCount; ++i) {
+        ContiguousTimerseries merged;
+
+        CHECK(series[i]->getShardCount() == 1);
+        CHECK(series[i]->snapshot(merged) == 10);
+        CHECK(merged.getStartTimes()[0] == i);
+        CHECK(merged.getStopTimes()[9] == i + 9);
+    }
+
+    // a series created after others are destroyed does not see their shards
+    series.clear();
+    ShardedTimerseries fresh;
+
+    fresh.append(1, 2);
+    CHECK(fresh.getShardCount() == 1);
+    CHECK(fresh.getSize() == 1);
+}
+
+}
+
+int main() {
+    testConcurrentMerge();
+    testTimers();
+    testManySeries();
+
+    return getExitCode();
+}
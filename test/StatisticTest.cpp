@@ -0,0 +1,163 @@
+/*
+ * File:   StatisticTest.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 24, 2026, 12:50 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+#include <list>
+#include <random>
+#include <utility>
+#include "Statistic.h"
+#include "Check.h"
+
+namespace {
+
+void checkEqual(const Statistic& actual, const Statistic& expected) {
+    CHECK(actual.getNumberOfElements() == expected.getNumberOfElements());
+    CHECK(actual.getPopulationSize() == expected.getPopulationSize());
+    CHECK(actual.getMin() == expected.getMin());
+    CHECK(actual.getMax() == expected.getMax());
+    CHECK_RELATIVE(actual.getMean(), expected.getMean(), 1e-12);
+    CHECK_RELATIVE(actual.getVariance(), expected.getVariance(), 1e-9);
+    CHECK(actual.getMedian() == expected.getMedian());
+    CHECK(actual.getFirstQuartile() == expected.getFirstQuartile());
+    CHECK(actual.getThirdQuartile() == expected.getThirdQuartile());
+}
+
+/*
+ * Adding values merges them into the sorted series and the moments. The result
+ * equals a Statistic calculated from all values at once.
+ */
+void testAdd() {
+    std::mt19937_64 generator(3);
+    std::exponential_distribution<double> distribution(0.01);
+    std::list<double> all;
+    Statistic merged;
+
+    for(int part = 0; part < 5; ++part) {
+        std::list<double>* values = new std::list<double>();
+
+        for(int i = 0; i < 1001 + part; ++i) {
+            values->push_back(distribution(generator));
+        }
+        all.insert(all.end(), values->begin(), values->end());
+        merged += values;
+    }
+
+    Statistic exact(std::move(all));
+    RunningStatistic running = merged.getRunningStatistic();
+
+    checkEqual(merged, exact);
+    CHECK(running.getNumberOfElements() == 5015);
+    CHECK_RELATIVE(running.getMean(), exact.getMean(), 1e-12);
+    CHECK_RELATIVE(running.getVariance(), exact.getVariance(), 1e-9);
+}
+
+/*
+ * The percentile methods agree with the worked values for the series 1 to 10.
+ */
+void testPercentiles() {
+    std::list<double> values;
+
+    for(int i = 10; i > 0; --i) {
+        values.push_back(i);
+    }
+
+    Statistic statistic(std::move(values));
+
+    CHECK(statistic.getPercentile(0, Statistic::NEAREST_RANK) == 1.0);
+    CHECK(statistic.getPercentile(25, Statistic::NEAREST_RANK) == 3.0);
+    CHECK(statistic.getPercentile(50, Statistic::NEAREST_RANK) == 5.0);
+    CHECK(statistic.getPercentile(100, Statistic::NEAREST_RANK) == 10.0);
+    CHECK(statistic.getPercentile(0, Statistic::AVERAGED) == 1.0);
+    CHECK(statistic.getPercentile(25, Statistic::AVERAGED) == 3.0);
+    CHECK(statistic.getPercentile(50, Statistic::AVERAGED) == 5.5);
+    CHECK(statistic.getPercentile(100, Statistic::AVERAGED) == 10.0);
+    CHECK(statistic.getPercentile(0, Statistic::LINEAR) == 1.0);
+    CHECK_NEAR(statistic.getPercentile(25, Statistic::LINEAR), 3.25, 1e-12);
+    CHECK_NEAR(statistic.getPercentile(90, Statistic::LINEAR), 9.1, 1e-12);
+    CHECK(statistic.getPercentile(100, Statistic::LINEAR) == 10.0);
+    CHECK(statistic.getPercentile(101) == 0.0);
+    CHECK(statistic.getPercentile(-1) == 0.0);
+    CHECK(statistic.getPercentile(50) == statistic.getMedian());
+
+    const double percentiles[] = {10, 50, 99};
+    double results[3];
+
+    statistic.getPercentiles(percentiles, results, 3,
+        Statistic::NEAREST_RANK);
+    CHECK(results[0] == 1.0);
+    CHECK(results[1] == 5.0);
+    CHECK(results[2] == 10.0);
+    CHECK(Statistic().getPercentile(50) == 0.0);
+}
+
+/*
+ * A moved Statistic takes over the values, and the moved-from one is empty.
+ */
+void testMove() {
+    Statistic original(std::list<double>{4, 1, 3, 2});
+    Statistic copy(original);
+    Statistic moved(std::move(original));
+
+    checkEqual(moved, copy);
+    CHECK(original.getNumberOfElements() == 0);
+    CHECK(original.getPopulationSize() == 0);
+    CHECK(original.getMean() == 0);
+    CHECK(original.getMax() == 0);
+    CHECK(original.getMedian() == 0);
+
+    Statistic assigned;
+    assigned = std::move(moved);
+    checkEqual(assigned, copy);
+    CHECK(moved.getNumberOfElements() == 0);
+    CHECK(moved.getVariance() == 0);
+
+    // the moved-from object can be used again
+    moved += new std::list<double>{7};
+    CHECK(moved.getNumberOfElements() == 1);
+    CHECK(moved.getMean() == 7);
+}
+
+}
+
+int main() {
+    testAdd();
+    testPercentiles();
+    testMove();
+
+    return getExitCode();
+}
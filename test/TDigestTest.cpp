@@ -0,0 +1,202 @@
+/*
+ * File:   TDigestTest.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 24, 2026, 1:20 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "TDigest.h"
+#include "Statistic.h"
+#include "Check.h"
+
+namespace {
+
+const int VALUES = 200000;
+const int DIGESTS = 8;
+const double PERCENTILES[] = {1, 10, 25, 50, 75, 90, 99, 99.9, 99.99};
+
+/*
+ * Returns true, if deserialize() throws std::invalid_argument for the blob.
+ */
+bool isRejected(const std::vector<std::uint8_t>& blob) {
+    try {
+        TDigest::deserialize(blob);
+    } catch(const std::invalid_argument&) {
+        return true;
+    }
+
+    return false;
+}
+
+/*
+ * Returns the blob with the compression, which follows the 4 bytes of the
+ * format, replaced by the value.
+ */
+std::vector<std::uint8_t> withCompression(std::vector<std::uint8_t> blob,
+        double value) {
+    std::uint64_t bits;
+
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    for(int i = 0; i < 8; ++i) {
+        blob[4 + i] = static_cast<std::uint8_t>(bits >> (8 * i));
+    }
+
+    return blob;
+}
+
+/*
+ * Digests of parts of the values are exchanged as blobs and merged. Their
+ * percentiles are within 5 % of the exact ones of all values.
+ */
+void testMergedPercentiles() {
+    std::mt19937_64 generator(11);
+    std::lognormal_distribution<double> distribution(std::log(50000.0), 1.0);
+    std::list<double> values;
+    std::vector<TDigest> digests(DIGESTS);
+
+    for(int i = 0; i < VALUES; ++i) {
+        double value = distribution(generator);
+
+        values.push_back(value);
+        digests[i % DIGESTS].add(value);
+    }
+
+    TDigest merged;
+
+    for(const TDigest& digest : digests) {
+        std::vector<std::uint8_t> blob = digest.serialize();
+
+        CHECK(blob.size() < 1024);
+        merged.merge(TDigest::deserialize(blob));
+    }
+
+    Statistic exact(std::move(values));
+
+    CHECK(merged.getNumberOfElements() == VALUES);
+    CHECK(merged.getMin() == exact.getMin());
+    CHECK(merged.getMax() == exact.getMax());
+    CHECK_RELATIVE(merged.getMean(), exact.getMean(), 1e-9);
+    CHECK(merged.getCentroidCount() <= 2 * merged.getCompression());
+
+    for(double percentile : PERCENTILES) {
+        CHECK_RELATIVE(merged.getPercentile(percentile),
+            exact.getPercentile(percentile), 0.05);
+    }
+}
+
+/*
+ * A deserialized digest answers exactly like the original, and broken blobs
+ * are rejected.
+ */
+void testSerialization() {
+    TDigest digest;
+
+    for(int i = 0; i < 10000; ++i) {
+        digest.add((i * 7919) % 10000);
+    }
+
+    std::vector<std::uint8_t> blob = digest.serialize();
+    TDigest copy = TDigest::deserialize(blob);
+
+    CHECK(copy.getNumberOfElements() == digest.getNumberOfElements());
+    CHECK(copy.getCentroidCount() == digest.getCentroidCount());
+
+    for(double percentile : PERCENTILES) {
+        CHECK(copy.getPercentile(percentile) ==
+            digest.getPercentile(percentile));
+    }
+
+    CHECK(isRejected(std::vector<std::uint8_t>(blob.begin(), blob.end() - 1)));
+    CHECK(not isRejected(withCompression(blob, TDigest::MAX_COMPRESSION)));
+    CHECK(isRejected(withCompression(blob, 1e300)));
+    CHECK(isRejected(withCompression(blob, TDigest::MIN_COMPRESSION - 1)));
+    CHECK(isRejected(withCompression(blob,
+        std::numeric_limits<double>::quiet_NaN())));
+    CHECK(isRejected(withCompression(blob,
+        std::numeric_limits<double>::infinity())));
+
+    blob[0] = 'X';
+    CHECK(isRejected(blob));
+}
+
+/*
+ * The constructor clamps the compression to the supported range.
+ */
+void testCompression() {
+    CHECK(TDigest(1e300).getCompression() == TDigest::MAX_COMPRESSION);
+    CHECK(TDigest(1).getCompression() == TDigest::MIN_COMPRESSION);
+    CHECK(TDigest(std::numeric_limits<double>::quiet_NaN()).getCompression()
+        == TDigest::MIN_COMPRESSION);
+    CHECK(TDigest(500).getCompression() == 500);
+}
+
+/*
+ * An empty digest answers 0, a single value is every percentile.
+ */
+void testSmall() {
+    TDigest digest;
+
+    CHECK(digest.getNumberOfElements() == 0);
+    CHECK(digest.getMedian() == 0);
+
+    digest.add(5);
+    CHECK(digest.getMedian() == 5);
+    CHECK(digest.getPercentile(0) == 5);
+    CHECK(digest.getPercentile(100) == 5);
+
+    digest.clear();
+    CHECK(digest.getNumberOfElements() == 0);
+}
+
+}
+
+int main() {
+    testMergedPercentiles();
+    testSerialization();
+    testCompression();
+    testSmall();
+
+    return getExitCode();
+}
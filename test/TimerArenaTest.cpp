@@ -0,0 +1,109 @@
+/*
+ * File:   TimerArenaTest.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 24, 2026, 11:55 AM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+#include <vector>
+#include "TimerArena.h"
+#include "Check.h"
+
+namespace {
+
+/*
+ * Counts the living objects, so a missing or a double destruction shows.
+ */
+struct Counted {
+    static int sAlive;
+
+    Counted() {
+        ++sAlive;
+    }
+
+    Counted(const Counted&) {
+        ++sAlive;
+    }
+
+    ~Counted() {
+        --sAlive;
+    }
+};
+
+int Counted::sAlive = 0;
+
+/*
+ * Destroyed objects leave holes, which are filled before the arena grows.
+ * reset() destroys every living object exactly once.
+ */
+void testReuse() {
+    TimerArena<Counted> arena;
+    std::vector<Counted*> objects;
+
+    for(int i = 0; i < 100; ++i) {
+        objects.push_back(arena.create());
+    }
+    std::size_t capacity = arena.getCapacity();
+
+    for(int round = 0; round < 1000; ++round) {
+        for(int i = 0; i < 100; i += 2) {
+            arena.destroy(objects[i]);
+        }
+        CHECK(Counted::sAlive == 50);
+        CHECK(arena.getSize() == 50);
+
+        for(int i = 0; i < 100; i += 2) {
+            objects[i] = arena.create();
+            CHECK(arena.owns(objects[i]));
+        }
+    }
+
+    CHECK(arena.getCapacity() == capacity);
+    CHECK(Counted::sAlive == 100);
+
+    arena.destroy(objects[3]);
+    arena.reset();
+    CHECK(Counted::sAlive == 0);
+    CHECK(arena.getSize() == 0);
+}
+
+}
+
+int main() {
+    testReuse();
+    CHECK(Counted::sAlive == 0);
+
+    return getExitCode();
+}
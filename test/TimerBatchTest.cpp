@@ -0,0 +1,93 @@
+/*
+ * File:   TimerBatchTest.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 24, 2026, 12:15 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+#include <cstddef>
+#include "TimerBatch.h"
+#include "Check.h"
+
+namespace {
+
+/*
+ * Measurements stay running until they are stopped. Running ones have no
+ * duration and are not appended to a series.
+ */
+template<class Clock>
+void testBatch() {
+    BasicTimerBatch<Clock> batch;
+    BasicContiguousTimerseries<Clock> series;
+    const std::size_t indices[] = {1, 3};
+
+    CHECK(batch.start(5) == 0);
+    CHECK(batch.getSize() == 5);
+    for(std::size_t i = 0; i < 5; ++i) {
+        CHECK(batch.isRunning(i));
+        CHECK(batch.getTime(i) == Timestamp::fromNanoSeconds(0));
+    }
+
+    batch.stop(indices, 2);
+    CHECK(not batch.isRunning(1));
+    CHECK(not batch.isRunning(3));
+    CHECK(batch.isRunning(0));
+    CHECK(batch.getTime(1) >= Timestamp::fromNanoSeconds(0));
+    CHECK(not batch.getTimer(3).isReset());
+    CHECK(not batch.getTimer(3).isRunning());
+    CHECK(batch.getTimer(0).isReset());
+    CHECK(batch.appendTo(series) == 2);
+
+    batch.stopAll();
+    for(std::size_t i = 0; i < 5; ++i) {
+        CHECK(not batch.isRunning(i));
+    }
+
+    batch.clear();
+    CHECK(batch.getSize() == 0);
+}
+
+}
+
+int main() {
+    // the CPU time clocks may return a reading of 0, which is no sentinel
+    CHECK(TimerBatch::RUNNING < 0);
+
+    testBatch<MonotonicClock>();
+    testBatch<ProcessCpuClock>();
+    testBatch<ThreadCpuClock>();
+
+    return getExitCode();
+}
@@ -0,0 +1,104 @@
+/*
+ * File:   TimerRegistryTest.cpp
+ * Author: Nils Döring
+ *
+ * Created on October 24, 2026, 12:10 PM
+ */
+
+/* Copyright (c) 2015, Nils Döring
+  All rights reserved.
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  * Neither the name of hrtimerpp nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "TimerRegistry.h"
+#include "Check.h"
+
+namespace {
+
+const int HANDLES = 500;
+const int ROUNDS = 20;
+
+/*
+ * Records round-robin into all handles, the duration of a handle is its index
+ * plus one.
+ */
+void recordAll(TimerRegistry& registry,
+        const std::vector<TimerRegistry::Handle>& handles) {
+    for(int round = 0; round < ROUNDS; ++round) {
+        for(int i = 0; i < HANDLES; ++i) {
+            registry.record(handles[i], 0, i + 1);
+        }
+    }
+}
+
+/*
+ * Hundreds of handles are recorded from the same threads. Every handle keeps
+ * exactly its own measurements.
+ */
+void testManyHandles() {
+    TimerRegistry registry;
+    std::vector<TimerRegistry::Handle> handles;
+
+    for(int i = 0; i < HANDLES; ++i) {
+        handles.push_back(registry.intern("series." + std::to_string(i)));
+    }
+    CHECK(registry.getSize() == HANDLES);
+    CHECK(registry.intern("series.7") == handles[7]);
+
+    std::thread other(recordAll, std::ref(registry), std::cref(handles));
+    recordAll(registry, handles);
+    other.join();
+
+    for(int i = 0; i < HANDLES; ++i) {
+        std::unique_ptr<Statistic> statistic(registry.getStatistic(handles[i],
+            ReadingsView<MonotonicClock>::NANOSECONDS));
+
+        CHECK(statistic->getNumberOfElements() == 2 * ROUNDS);
+        CHECK(statistic->getMin() == i + 1);
+        CHECK(statistic->getMax() == i + 1);
+    }
+
+    registry.clear();
+    std::unique_ptr<Statistic> statistic(registry.getStatistic(handles[0],
+        ReadingsView<MonotonicClock>::NANOSECONDS));
+    CHECK(statistic->getNumberOfElements() == 0);
+}
+
+}
+
+int main() {
+    testManyHandles();
+
+    return getExitCode();
+}